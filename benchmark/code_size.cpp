@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file code_size.cpp
+/// -------------------
+///
+/// Size probes: one noinline function per (result type, usage mode)
+/// combination. Compile with -ffunction-sections and inspect the resulting
+/// symbol sizes (see code_size.sh) to get a per-instantiation .text breakdown.
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include <psi/err/errno.hpp>
+#include <psi/err/fallible_result.hpp>
+
+#include <boost/config.hpp>
+
+#include <system_error>
+#include <version>
+#if __cpp_lib_expected
+#include <expected>
+#endif // __cpp_lib_expected
+//------------------------------------------------------------------------------
+using namespace psi::err;
+
+struct handle
+{
+    int * p;
+    operator bool() const noexcept { return p != nullptr; } // implicit: required by compressed_result_error_variant
+};
+struct empty_error {};
+static_assert( compressed_result_error_variant<handle, empty_error>, "The 'compressed' specialisation is the one under test." );
+
+// Opaque producers (defined in no TU: the probes are only compiled, never linked)
+fallible_result<int   , last_errno > produce_fallible_int       ();
+result_or_error<int   , last_errno > produce_result_or_error_int();
+result_or_error<handle, empty_error> produce_compressed         ();
+fallible_result<void  , last_errno > produce_fallible_void      ();
+void_or_error  <        last_errno > produce_void_or_error      ();
+int                                  produce_throwing_int       ();
+int                                  produce_error_code_int     ( std::error_code & );
+#if __cpp_lib_expected
+std::expected<int, int>              produce_expected_int       ();
+#endif // __cpp_lib_expected
+fallible_result<long  , last_errno > produce_fallible_long      ();
+fallible_result<short , last_errno > produce_fallible_short     ();
+fallible_result<double, last_errno > produce_fallible_double    ();
+fallible_result<int * , last_errno > produce_fallible_pointer   ();
+
+// Producer side (error construction paths)
+BOOST_NOINLINE fallible_result<int, last_errno> size_probe_make_fallible_int( int value ) { if ( value < 0 ) return last_errno{}; return value; }
+BOOST_NOINLINE fallible_result<void, last_errno> size_probe_make_fallible_void( int value ) { if ( value < 0 ) return last_errno{}; return no_err; }
+BOOST_NOINLINE int size_probe_make_throwing_int( int value ) { if ( value < 0 ) throw std::system_error( value, std::generic_category() ); return value; }
+
+// Consumer side
+BOOST_NOINLINE int  size_probe_fallible_throw_if_error                 () { return produce_fallible_int(); }
+// (the same Error with different Results: the throw path, i.e. the
+// exception construction, is to be shared - the probes differ only in the
+// test+call sequence)
+BOOST_NOINLINE long   size_probe_fallible_throw_if_error_long          () { return produce_fallible_long   (); }
+BOOST_NOINLINE short  size_probe_fallible_throw_if_error_short         () { return produce_fallible_short  (); }
+BOOST_NOINLINE double size_probe_fallible_throw_if_error_double        () { return produce_fallible_double (); }
+BOOST_NOINLINE int *  size_probe_fallible_throw_if_error_pointer       () { return produce_fallible_pointer(); }
+BOOST_NOINLINE int  size_probe_fallible_as_result_or_error             () { auto const r( produce_fallible_int()() ); return r ? *r : -1; }
+BOOST_NOINLINE void size_probe_fallible_void_uninspected_destructor    () { produce_fallible_void(); }
+BOOST_NOINLINE int  size_probe_result_or_error_inspect                 () { auto const r( produce_result_or_error_int() ); return r ? *r : -1; }
+BOOST_NOINLINE int  size_probe_result_or_error_throw_if_error          () { auto r( produce_result_or_error_int() ); r.throw_if_error(); return *r; }
+BOOST_NOINLINE bool size_probe_compressed_inspect                      () { auto const r( produce_compressed() ); return static_cast<bool>( r ); }
+BOOST_NOINLINE bool size_probe_void_or_error_inspect                   () { auto const r( produce_void_or_error() ); return static_cast<bool>( r ); }
+BOOST_NOINLINE int  size_probe_throw_catch                             () { try { return produce_throwing_int(); } catch ( ... ) { return -1; } }
+BOOST_NOINLINE int  size_probe_error_code_out_param                    () { std::error_code ec; auto const r( produce_error_code_int( ec ) ); return ec ? -1 : r; }
+#if __cpp_lib_expected
+BOOST_NOINLINE int  size_probe_expected_inspect                        () { auto const r( produce_expected_int() ); return r ? *r : -1; }
+#endif // __cpp_lib_expected
+
+// Propagation (expected: a single compare-and-branch on the success path)
+BOOST_NOINLINE result_or_error<int, last_errno> size_probe_propagate_method         () { auto r( produce_result_or_error_int() ); if ( !r ) return r.propagate(); return *r + 1; }
+BOOST_NOINLINE result_or_error<int, last_errno> size_probe_propagate_save_macro     () { PSI_ERR_SAVE_RESULT_OR_PROPAGATE_FAILURE( r, produce_result_or_error_int() ); return *r + 1; }
+BOOST_NOINLINE void_or_error  <     last_errno> size_probe_propagate_failure_macro  () { PSI_ERR_PROPAGATE_FAILURE( produce_fallible_void() ); return no_err; }
+#ifdef PSI_ERR_TRY
+BOOST_NOINLINE result_or_error<int, last_errno> size_probe_propagate_try            () { return PSI_ERR_TRY( produce_result_or_error_int() ) + 1; }
+BOOST_NOINLINE result_or_error<int, last_errno> size_probe_propagate_try_fallible   () { return PSI_ERR_TRY( produce_fallible_int() ) + 1; }
+#endif // PSI_ERR_TRY
+BOOST_NOINLINE result_or_error<int, last_errno> size_probe_propagate_and_then       () { return produce_result_or_error_int().and_then( []( int && value ) { return produce_result_or_error_int().transform( [ value ]( int && other ) { return value + other; } ); } ); }
+BOOST_NOINLINE int                              size_probe_propagate_chain_value_or () { return produce_fallible_int().transform( []( int && value ) { return value + 1; } ).value_or( -1 ); }
+#if __cpp_lib_expected
+BOOST_NOINLINE std::expected<int, int>          size_probe_propagate_expected       () { auto const r( produce_expected_int() ); if ( !r ) return std::unexpected( r.error() ); return *r + 1; }
+#endif // __cpp_lib_expected
+
+// std::expected interop (expected: a test of the source's discriminator and a
+// single move of the payload - i.e. nothing beyond an inlined
+// 'if ( source ) result else error')
+#if __cpp_lib_expected
+BOOST_NOINLINE result_or_error<int   , last_errno > size_probe_expected_to_result_or_error      ( std::expected<int   , last_errno > && source ) { return std::move( source ); }
+BOOST_NOINLINE result_or_error<size_t, errno_code > size_probe_expected_to_sentinel             ( std::expected<size_t, errno_code > && source ) { return std::move( source ); }
+BOOST_NOINLINE result_or_error<handle, empty_error> size_probe_expected_to_compressed           ( std::expected<handle, empty_error> && source ) { return std::move( source ); }
+BOOST_NOINLINE void_or_error  <        last_errno > size_probe_expected_to_void_or_error        ( std::expected<void  , last_errno > && source ) { return std::move( source ); }
+BOOST_NOINLINE std::expected  <int   , last_errno > size_probe_result_or_error_to_expected      ( result_or_error<int   , last_errno > && source ) { return std::move( source ); }
+BOOST_NOINLINE std::expected  <size_t, errno_code > size_probe_sentinel_to_expected             ( result_or_error<size_t, errno_code > && source ) { return std::move( source ); }
+BOOST_NOINLINE std::expected  <handle, empty_error> size_probe_compressed_to_expected           ( result_or_error<handle, empty_error> && source ) { return std::move( source ); }
+BOOST_NOINLINE std::expected  <void  , last_errno > size_probe_void_or_error_to_expected        ( void_or_error  <        last_errno > && source ) { return std::move( source ); }
+BOOST_NOINLINE std::expected  <int   , last_errno > size_probe_fallible_to_expected             () { return produce_fallible_int(); }
+#endif // __cpp_lib_expected
@@ -0,0 +1,49 @@
+#!/bin/sh
+################################################################################
+#
+# Per-instantiation .text size report for code_size.cpp.
+#
+# Usage: CXX=<compiler> CONFIG_EX=<config_ex include dir> benchmark/code_size.sh [extra flags]
+#
+# Set DISASSEMBLE=1 to also dump the disassembly of the propagation probes.
+# Set CHECK=1 to fail if any of the budgets in code_size.budget is exceeded.
+#
+################################################################################
+set -e
+
+here=$( cd "$( dirname "$0" )" && pwd )
+cxx=${CXX:-c++}
+out=${TMPDIR:-/tmp}/psi_err_code_size.o
+
+"$cxx" -std=c++2b -O2 -DNDEBUG -ffunction-sections -fno-asynchronous-unwind-tables \
+    -I"$here/../include" ${CONFIG_EX:+-I"$CONFIG_EX"} "$@" \
+    -c "$here/code_size.cpp" -o "$out"
+
+sizes=${TMPDIR:-/tmp}/psi_err_code_size.txt
+nm -S -C --size-sort -t d "$out" | awk '$3 ~ /[tTwW]/ { size = $2 + 0; $1 = $2 = $3 = ""; sub( /^ +/, "" ); printf "%12d %s\n", size, $0 }' > "$sizes"
+
+echo "size (bytes) symbol"
+grep -E 'size_probe_|psi::err::' "$sizes"
+echo
+size "$out"
+
+if [ -n "$DISASSEMBLE" ]; then
+    echo
+    objdump -d -C --no-show-raw-insn "$out" | awk '/^[0-9a-f]+ <.*size_probe_propagate/,/^$/'
+fi
+
+if [ -n "$CHECK" ]; then
+    echo
+    awk '
+        NR == FNR { size[ FNR ] = $1; $1 = ""; sub( /^ +/, "" ); symbol[ FNR ] = $0; symbols = FNR; next }
+        /^#/ || NF < 2 { next }
+        {
+            budget = $1; $1 = ""; sub( /^ +/, "" ); total = 0
+            for ( i = 1; i <= symbols; ++i ) if ( index( symbol[ i ], $0 ) ) total += size[ i ]
+            status = total > budget ? "OVER" : "ok"
+            if ( total > budget ) failed = 1
+            printf "%-4s %6d / %6d %s\n", status, total, budget, $0
+        }
+        END { exit failed }
+    ' "$sizes" "$here/code_size.budget"
+fi
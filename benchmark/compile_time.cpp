@@ -0,0 +1,100 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file compile_time.cpp
+/// ----------------------
+///
+/// Compile time (throughput) probe: PSI_ERR_COMPILE_TIME_TYPES distinct
+/// Result types, each pushed through the usual API surface (construction,
+/// fallible_result conversions, throw_if_error, the combinators, operator*,
+/// comparisons). Meant to be timed with -fsyntax-only (see compile_time.sh)
+/// i.e. it measures the (per-instantiation) frontend cost of the library.
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include <psi/err/errno.hpp>
+#include <psi/err/fallible_result.hpp>
+
+#include <cstddef>
+#include <utility>
+//------------------------------------------------------------------------------
+#ifndef PSI_ERR_COMPILE_TIME_TYPES
+#   define PSI_ERR_COMPILE_TIME_TYPES 256
+#endif // PSI_ERR_COMPILE_TIME_TYPES
+
+using namespace psi::err;
+
+// every third payload is not trivially movable (i.e. a mix of the primary and
+// the 'sentinel' specialisations)
+template <std::size_t I, bool trivial = ( I % 3 != 0 )>
+struct payload
+{
+    payload( int const v ) noexcept : value( v ) {}
+
+    int value;
+};
+
+template <std::size_t I>
+struct payload<I, false>
+{
+    payload( int     const   v     ) noexcept : value( v           ) {}
+    payload( payload &&      other ) noexcept : value( other.value ) {}
+
+    int value;
+};
+
+template <std::size_t I>
+fallible_result<payload<I>, last_errno> produce( int const v ) noexcept
+{
+    if ( v < 0 )
+        return last_errno{};
+    return payload<I>( v );
+}
+
+template <std::size_t I>
+result_or_error<payload<I>, errno_code> produce_code( int const v ) noexcept
+{
+    if ( v < 0 )
+        return errno_code( EINVAL );
+    return payload<I>( v );
+}
+
+template <std::size_t I>
+int consume( int const v )
+{
+    payload<I> const thrown( produce<I>( v ) ); // (throwing conversion)
+
+    auto saved( produce<I>( v ).as_result_or_error() );
+    if ( saved != no_err )
+        return -1;
+    saved.throw_if_error();
+
+    auto const chained
+    (
+        produce_code<I>( v )
+            .and_then ( []( payload<I> && p ) { return produce_code<I>( p.value - 1 ); } )
+            .transform( []( payload<I> && p ) { return p.value * 2; } )
+            .value_or ( 0 )
+    );
+    return thrown.value + saved->value + ( *std::move( saved ) ).value + chained;
+}
+
+template <std::size_t ... I>
+int consume_all( std::index_sequence<I...> )
+{
+    int const results[]{ consume<I>( static_cast<int>( I ) )... };
+    int sum{ 0 };
+    for ( auto const result : results )
+        sum += result;
+    return sum;
+}
+
+int main() { return consume_all( std::make_index_sequence<PSI_ERR_COMPILE_TIME_TYPES>{} ) == 0; }
@@ -0,0 +1,60 @@
+#!/bin/sh
+################################################################################
+#
+# Frontend (-fsyntax-only) time report for compile_time.cpp: the total time
+# for each of the COUNTS (default "0 64 256 1024") distinct Result type
+# counts and the per-type cost (relative to the 0 types, i.e. header only,
+# run).
+#
+# Usage: CXX=<compiler> CONFIG_EX=<config_ex include dir> benchmark/compile_time.sh [extra flags]
+#
+# Set RUNS (default 3) to choose the number of (best of) runs per count.
+# Set TIME_REPORT=1 to also print the compiler's -ftime-report for the
+# largest count.
+#
+################################################################################
+set -e
+
+here=$( cd "$( dirname "$0" )" && pwd )
+cxx=${CXX:-c++}
+counts=${COUNTS:-0 64 256 1024}
+runs=${RUNS:-3}
+
+now_ns()
+{
+    case $( date +%N ) in
+        *N*) perl -MTime::HiRes=time -e 'printf "%.0f\n", time() * 1e9' ;;
+        *  ) date +%s%N ;;
+    esac
+}
+
+compile()
+{
+    types=$1; shift
+    "$cxx" -std=c++20 -fsyntax-only -I"$here/../include" ${CONFIG_EX:+-I"$CONFIG_EX"} \
+        -DPSI_ERR_COMPILE_TIME_TYPES="$types" "$@" "$here/compile_time.cpp"
+}
+
+echo "   types    best (ms)   per type (us)"
+baseline=
+largest=
+for count in $counts; do
+    best=
+    run=0
+    while [ $run -lt "$runs" ]; do
+        start=$( now_ns )
+        compile "$count" "$@"
+        elapsed=$(( ( $( now_ns ) - start ) / 1000 ))
+        if [ -z "$best" ] || [ "$elapsed" -lt "$best" ]; then best=$elapsed; fi
+        run=$(( run + 1 ))
+    done
+    [ -n "$baseline" ] || baseline=$best
+    if [ "$count" -gt 0 ]; then per_type=$(( ( best - baseline ) / count )); else per_type=-; fi
+    printf "%8d %12d %15s\n" "$count" $(( best / 1000 )) "$per_type"
+    largest=$count
+done
+
+if [ -n "$TIME_REPORT" ]; then
+    echo
+    compile "$largest" -ftime-report "$@"
+fi
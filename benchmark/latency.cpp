@@ -0,0 +1,278 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file latency.cpp
+/// -----------------
+///
+/// Per-call latency of the different Psi.Err result types versus plain
+/// throw/catch, std::expected and std::error_code out-parameters, measured at
+/// several failure rates.
+///
+/// Build (from the repository root, with the config_ex submodule include
+/// directory on the include path):
+///   c++ -std=c++2b -O3 -DNDEBUG -Iinclude -I<config_ex>/include
+///       benchmark/latency.cpp -o latency
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#include <psi/err/errno.hpp>
+#include <psi/err/fallible_result.hpp>
+
+#include <boost/config.hpp>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+#include <version>
+#if __cpp_lib_expected
+#include <expected>
+#endif // __cpp_lib_expected
+//------------------------------------------------------------------------------
+namespace
+{
+//------------------------------------------------------------------------------
+
+using namespace psi::err;
+
+std::size_t constexpr iterations = 1 << 20;
+
+struct handle
+{
+    int * p;
+    operator bool() const noexcept { return p != nullptr; } // implicit: required by compressed_result_error_variant
+};
+struct empty_error {};
+static_assert( compressed_result_error_variant<handle, empty_error>, "The 'compressed' specialisation is the one under test." );
+
+int storage[ 1024 ];
+
+BOOST_NOINLINE int set_errno_and_fail() noexcept { errno = EAGAIN; return -1; }
+
+// Functions under test
+BOOST_NOINLINE fallible_result<int, last_errno> fallible_int( bool const fail, int value ) noexcept
+{
+    if ( BOOST_UNLIKELY( fail ) ) { set_errno_and_fail(); return last_errno{}; }
+    return value;
+}
+
+BOOST_NOINLINE result_or_error<int, last_errno> result_or_error_int( bool const fail, int value ) noexcept
+{
+    if ( BOOST_UNLIKELY( fail ) ) { set_errno_and_fail(); return last_errno{}; }
+    return value;
+}
+
+BOOST_NOINLINE result_or_error<handle, empty_error> compressed_handle( bool const fail, int value ) noexcept
+{
+    return handle{ fail ? nullptr : &storage[ value % std::size( storage ) ] };
+}
+
+BOOST_NOINLINE fallible_result<void, last_errno> fallible_void( bool const fail ) noexcept
+{
+    if ( BOOST_UNLIKELY( fail ) ) { set_errno_and_fail(); return last_errno{}; }
+    return no_err;
+}
+
+BOOST_NOINLINE void_or_error<last_errno> void_or_error_void( bool const fail ) noexcept
+{
+    if ( BOOST_UNLIKELY( fail ) ) { set_errno_and_fail(); return last_errno{}; }
+    return no_err;
+}
+
+BOOST_NOINLINE int throwing_int( bool const fail, int value )
+{
+    if ( BOOST_UNLIKELY( fail ) ) throw std::system_error( EAGAIN, std::generic_category() );
+    return value;
+}
+
+BOOST_NOINLINE int error_code_int( bool const fail, int value, std::error_code & error ) noexcept
+{
+    if ( BOOST_UNLIKELY( fail ) ) { error.assign( EAGAIN, std::generic_category() ); return 0; }
+    error.clear();
+    return value;
+}
+
+#if __cpp_lib_expected
+BOOST_NOINLINE std::expected<int, int> expected_int( bool const fail, int value ) noexcept
+{
+    if ( BOOST_UNLIKELY( fail ) ) return std::unexpected( EAGAIN );
+    return value;
+}
+#endif // __cpp_lib_expected
+
+
+struct totals
+{
+    std::uint64_t sum      = 0;
+    std::uint64_t failures = 0;
+};
+
+// Consumers (one per variant, each iterating over a precomputed failure pattern)
+using pattern_t = std::vector<std::uint8_t>;
+
+totals fallible_as_exception( pattern_t const & pattern )
+{
+    totals t;
+    for ( std::size_t i{ 0 }; i < pattern.size(); ++i )
+    {
+        try { t.sum += static_cast<int>( fallible_int( pattern[ i ], int( i ) ) ); }
+        catch ( std::exception const & ) { ++t.failures; }
+    }
+    return t;
+}
+
+totals fallible_as_result_or_error( pattern_t const & pattern )
+{
+    totals t;
+    for ( std::size_t i{ 0 }; i < pattern.size(); ++i )
+    {
+        auto const result( fallible_int( pattern[ i ], int( i ) )() );
+        if ( result ) t.sum += *result;
+        else          ++t.failures;
+    }
+    return t;
+}
+
+totals plain_result_or_error( pattern_t const & pattern )
+{
+    totals t;
+    for ( std::size_t i{ 0 }; i < pattern.size(); ++i )
+    {
+        auto const result( result_or_error_int( pattern[ i ], int( i ) ) );
+        if ( result ) t.sum += *result;
+        else          ++t.failures;
+    }
+    return t;
+}
+
+totals compressed_result_or_error( pattern_t const & pattern )
+{
+    totals t;
+    for ( std::size_t i{ 0 }; i < pattern.size(); ++i )
+    {
+        auto const result( compressed_handle( pattern[ i ], int( i ) ) );
+        if ( result ) t.sum += static_cast<std::uint64_t>( result->p - storage );
+        else          ++t.failures;
+    }
+    return t;
+}
+
+totals fallible_void_self_throw( pattern_t const & pattern )
+{
+    // exercises the (PSI_RELEASE_FORCEINLINE) destructor ->
+    // throw_if_uninspected_error() path
+    totals t;
+    for ( std::size_t i{ 0 }; i < pattern.size(); ++i )
+    {
+        try { fallible_void( pattern[ i ] ); ++t.sum; }
+        catch ( std::exception const & ) { ++t.failures; }
+    }
+    return t;
+}
+
+totals plain_void_or_error( pattern_t const & pattern )
+{
+    totals t;
+    for ( std::size_t i{ 0 }; i < pattern.size(); ++i )
+    {
+        auto const result( void_or_error_void( pattern[ i ] ) );
+        if ( result ) ++t.sum;
+        else          ++t.failures;
+    }
+    return t;
+}
+
+totals throw_catch( pattern_t const & pattern )
+{
+    totals t;
+    for ( std::size_t i{ 0 }; i < pattern.size(); ++i )
+    {
+        try { t.sum += throwing_int( pattern[ i ], int( i ) ); }
+        catch ( std::exception const & ) { ++t.failures; }
+    }
+    return t;
+}
+
+totals error_code_out_param( pattern_t const & pattern )
+{
+    totals t;
+    std::error_code error;
+    for ( std::size_t i{ 0 }; i < pattern.size(); ++i )
+    {
+        auto const result( error_code_int( pattern[ i ], int( i ), error ) );
+        if ( !error ) t.sum += result;
+        else          ++t.failures;
+    }
+    return t;
+}
+
+#if __cpp_lib_expected
+totals std_expected( pattern_t const & pattern )
+{
+    totals t;
+    for ( std::size_t i{ 0 }; i < pattern.size(); ++i )
+    {
+        auto const result( expected_int( pattern[ i ], int( i ) ) );
+        if ( result ) t.sum += *result;
+        else          ++t.failures;
+    }
+    return t;
+}
+#endif // __cpp_lib_expected
+
+
+pattern_t make_pattern( double const failure_rate )
+{
+    std::mt19937                rng( 42 );
+    std::bernoulli_distribution failure( failure_rate );
+    pattern_t pattern( iterations );
+    for ( auto & fail : pattern )
+        fail = failure( rng );
+    return pattern;
+}
+
+void run( char const * const name, totals ( & consumer )( pattern_t const & ), pattern_t const & pattern )
+{
+    consumer( pattern ); // warm up
+    auto const start( std::chrono::steady_clock::now() );
+    auto const t    ( consumer( pattern )              );
+    auto const end  ( std::chrono::steady_clock::now() );
+    auto const ns   ( std::chrono::duration<double, std::nano>( end - start ).count() );
+    std::printf( "  %-32s %9.2f ns/call (failures: %llu, checksum: %llu)\n", name, ns / double( pattern.size() ), static_cast<unsigned long long>( t.failures ), static_cast<unsigned long long>( t.sum ) );
+}
+
+//------------------------------------------------------------------------------
+} // anonymous namespace
+//------------------------------------------------------------------------------
+
+int main()
+{
+    for ( auto const failure_rate : { 0.0, 0.001, 0.1, 0.5 } )
+    {
+        auto const pattern( make_pattern( failure_rate ) );
+        std::printf( "failure rate %.1f%%:\n", failure_rate * 100 );
+        run( "fallible_result (throw mode)"    , fallible_as_exception      , pattern );
+        run( "fallible_result (error mode)"    , fallible_as_result_or_error, pattern );
+        run( "result_or_error<int>"            , plain_result_or_error      , pattern );
+        run( "result_or_error<compressed>"     , compressed_result_or_error , pattern );
+        run( "fallible_result<void> self-throw", fallible_void_self_throw   , pattern );
+        run( "void_or_error"                   , plain_void_or_error        , pattern );
+        run( "throw/catch"                     , throw_catch                , pattern );
+        run( "std::error_code &"               , error_code_out_param       , pattern );
+    #if __cpp_lib_expected
+        run( "std::expected"                   , std_expected               , pattern );
+    #endif // __cpp_lib_expected
+    }
+}
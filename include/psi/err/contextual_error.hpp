@@ -0,0 +1,271 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file contextual_error.hpp
+/// --------------------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "exceptions.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+#ifndef PSI_ERR_CONTEXT_ARENA_SIZE
+#   define PSI_ERR_CONTEXT_ARENA_SIZE 4096
+#endif // PSI_ERR_CONTEXT_ARENA_SIZE
+
+namespace detail
+{
+    struct context_handle
+    {
+        std::uint32_t position{ 0 }; ///< in the (unwrapped) stream of the arena
+        std::uint16_t arena   { 0 }; ///< id of the owning (thread's) arena - 0 - no context
+        std::uint16_t length  { 0 };
+    }; // struct context_handle
+
+    ////////////////////////////////////////////////////////////////////////////
+    // A per-thread, fixed size ring of context texts: writing never allocates
+    // (nor fails) - the oldest texts simply get overwritten (and their handles
+    // detect that).
+    ////////////////////////////////////////////////////////////////////////////
+
+    class context_arena
+    {
+    public:
+        static std::uint32_t constexpr capacity  { PSI_ERR_CONTEXT_ARENA_SIZE };
+        static std::uint16_t constexpr max_length{ static_cast<std::uint16_t>( std::min<std::uint32_t>( capacity / 8, 512 ) ) }; ///< longer contexts get truncated
+
+        // (powers of two - positions are unwrapped 32 bit counters)
+        static_assert( std::has_single_bit( capacity ) && capacity >= 64 && capacity <= ( 1U << 24 ), "PSI_ERR_CONTEXT_ARENA_SIZE has to be a (reasonable) power of two." );
+
+        static context_arena & this_thread() noexcept
+        {
+            static constinit thread_local context_arena arena;
+            return arena;
+        }
+
+        template <typename ... Pieces>
+        context_handle write( Pieces const & ... pieces ) noexcept
+        {
+            if ( BOOST_UNLIKELY( !id_ ) ) // (ids wrap around - skipping 0)
+                while ( !( id_ = static_cast<std::uint16_t>( next_id.fetch_add( 1, std::memory_order_relaxed ) + 1 ) ) ) {}
+
+            // keep every text contiguous: skip the tail of the ring if it is
+            // too short for a maximum length text
+            if ( capacity - head_ % capacity < max_length )
+                head_ += capacity - head_ % capacity;
+
+            auto * const begin( &buffer_[ head_ % capacity ] );
+            auto *       out  ( begin );
+            ( append( out, begin + max_length, pieces ), ... );
+
+            context_handle const handle{ head_, id_, static_cast<std::uint16_t>( out - begin ) };
+            head_ += handle.length;
+            return handle;
+        }
+
+        /// Empty if the text has been overwritten in the meantime or belongs to
+        /// another thread's arena.
+        std::string_view read( context_handle const handle ) const noexcept
+        {
+            if ( handle.arena != id_ || !id_ || head_ - handle.position > capacity )
+                return {};
+            return { &buffer_[ handle.position % capacity ], handle.length };
+        }
+
+    private:
+        static void append( char * & out, char * const end, std::string_view const text ) noexcept
+        {
+            auto const length( std::min<std::size_t>( text.size(), static_cast<std::size_t>( end - out ) ) );
+            std::memcpy( out, text.data(), length );
+            out += length;
+        }
+
+        template <typename Piece>
+        static void append( char * & out, char * const end, Piece const & piece ) noexcept
+        {
+            if constexpr ( std::is_convertible_v<Piece const &, std::string_view> )
+                append( out, end, std::string_view( piece ) );
+            else if constexpr ( std::is_same_v<Piece, char> )
+            {
+                if ( out != end ) *out++ = piece;
+            }
+            else if constexpr ( std::is_same_v<Piece, bool> )
+                append( out, end, piece ? std::string_view( "true" ) : std::string_view( "false" ) );
+            else if constexpr ( std::is_pointer_v<Piece> )
+            {
+                append( out, end, std::string_view( "0x" ) );
+                append( out, end, reinterpret_cast<std::uintptr_t>( piece ), 16 );
+            }
+            else
+            {
+                static_assert( std::is_arithmetic_v<Piece> || std::is_enum_v<Piece>, "Unsupported context piece type (string_view convertible, arithmetic, enum and pointer types are supported)." );
+                if constexpr ( std::is_enum_v<Piece> ) append( out, end, static_cast<std::underlying_type_t<Piece>>( piece ) );
+                else                                   append( out, end, piece, 10 );
+            }
+        }
+
+        template <typename Number>
+        static void append( char * & out, char * const end, Number const number, [[ maybe_unused ]] int const base ) noexcept
+        {
+            std::to_chars_result result;
+            if constexpr ( std::is_floating_point_v<Number> ) result = std::to_chars( out, end, number );
+            else                                              result = std::to_chars( out, end, number, base );
+            if ( result.ec == std::errc{} )
+                out = result.ptr;
+        }
+
+        static inline constinit std::atomic<std::uint32_t> next_id{ 0 };
+
+        std::uint16_t id_  { 0 };
+        std::uint32_t head_{ 0 };
+        char          buffer_[ capacity ]{}; // (zero initialised, i.e. .tbss)
+    }; // class context_arena
+} // namespace detail
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class contextual_error
+///
+/// \brief An Error (code) plus a small handle to a context text (a path, an
+/// offset, a peer address...) stored in a bounded, per-thread ring arena.
+///
+/// \detail The context pieces (string_view convertibles, numbers, enums and
+/// pointers - simply concatenated) are written straight into the arena by the
+/// (cold, out-of-line) constructor: nothing is allocated on the error path
+/// and the Error grows only by an 8 byte handle (compared to e.g. a
+/// std::string member). The full message (the what() of the Error's exception
+/// followed by the context) is materialised only by make_exception(), i.e.
+/// when actually throwing (the exception derives from the one made from the plain Error so
+/// the existing catch clauses keep working).
+/// The arena is bounded (PSI_ERR_CONTEXT_ARENA_SIZE bytes per thread, texts
+/// are truncated to context_arena::max_length) so, during an error storm, the
+/// contexts of older errors get overwritten: context() then returns an empty
+/// string - as it does on threads other than the one which created the error
+/// (e.g. after a result_channel handover). The returned string_view is valid
+/// only until more contexts get written on the same thread.
+/// Usage:
+///     return contextual_error<last_errno>{ last_errno{}, "open(", path, ")" };
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Error>
+class contextual_error
+{
+public:
+    using error_type = Error;
+
+    contextual_error( Error const  & error ) noexcept( std::is_nothrow_copy_constructible_v<Error> ) : error_( error            ) {}
+    contextual_error( Error       && error ) noexcept( std::is_nothrow_move_constructible_v<Error> ) : error_( std::move( error ) ) {}
+
+    template <typename ... Pieces> requires( sizeof...( Pieces ) > 0 )
+    BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+    contextual_error( Error error, Pieces const & ... context ) noexcept( std::is_nothrow_move_constructible_v<Error> )
+        : error_( std::move( error ) ), context_( detail::context_arena::this_thread().write( context... ) ) {}
+
+    Error       &  error()       &  noexcept { return error_; }
+    Error const &  error() const &  noexcept { return error_; }
+    Error       && error()       && noexcept { return std::move( error_ ); }
+
+    operator Error const & () const noexcept { return error_; }
+
+    bool has_context() const noexcept { return !context().empty(); }
+
+    std::string_view context() const noexcept { return detail::context_arena::this_thread().read( context_ ); }
+
+private:
+    Error                  error_;
+    detail::context_handle context_;
+}; // class contextual_error
+
+namespace detail
+{
+    template <class T>
+    bool constexpr is_contextual_error{ false };
+    template <class Error>
+    bool constexpr is_contextual_error<contextual_error<Error>>{ true };
+} // namespace detail
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class contextual_exception
+///
+/// \brief The exception made from a contextual_error: Exception (the one made
+/// from the Error) with the context appended to its what() ("<what>: <context>").
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Exception>
+class contextual_exception : public Exception
+{
+public:
+    contextual_exception( Exception && exception, std::string_view const context ) noexcept( std::is_nothrow_move_constructible_v<Exception> )
+        : Exception( std::move( exception ) )
+    {
+        if ( context.empty() )
+            return;
+    #ifndef BOOST_NO_EXCEPTIONS
+        try {
+    #endif // BOOST_NO_EXCEPTIONS
+        message_  = Exception::what();
+        message_ += ": ";
+        message_ += context;
+    #ifndef BOOST_NO_EXCEPTIONS
+        } catch ( ... ) { message_.clear(); } // (fall back to the plain what())
+    #endif // BOOST_NO_EXCEPTIONS
+    }
+
+    char const * what() const noexcept override { return message_.empty() ? Exception::what() : message_.c_str(); }
+
+private:
+    std::string message_;
+}; // class contextual_exception
+
+
+template <class Contextual>
+requires detail::is_contextual_error<std::remove_cvref_t<Contextual>>
+BOOST_ATTRIBUTES( BOOST_COLD )
+auto BOOST_CC_REG make_exception( Contextual && error )
+{
+    auto const context( error.context() );
+    auto && exception{ make_exception( std::forward<Contextual>( error ).error() ) }; // (ADL)
+    using exception_t = std::remove_cvref_t<decltype( exception )>;
+    if constexpr ( std::is_base_of_v<std::exception, exception_t> && !std::is_final_v<exception_t> )
+        return contextual_exception<exception_t>( exception_t( std::forward<decltype( exception )>( exception ) ), context );
+    else
+        return exception_t( std::forward<decltype( exception )>( exception ) );
+}
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
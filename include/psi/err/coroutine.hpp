@@ -0,0 +1,326 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file coroutine.hpp
+/// -------------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "fallible_result.hpp"
+#include "result_or_error.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <type_traits>
+#include <utility>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+template <class Result, class Error, class Allocator = std::allocator<std::byte>>
+class fallible_coroutine;
+
+namespace detail
+{
+    // (converts through operator result_or_error &&, like a fallible_result -
+    // see preferred_source)
+    template <class Result, class Error, class Allocator>
+    bool constexpr is_fallible_result<fallible_coroutine<Result, Error, Allocator>>{ true };
+
+    template <class Error, class Allocator>
+    class coroutine_promise_base
+    {
+    public:
+        std::suspend_never  initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend  () const noexcept { return {}; }
+
+    #ifdef BOOST_NO_EXCEPTIONS
+        [[ noreturn ]] void unhandled_exception() noexcept { std::abort(); }
+    #else
+        void unhandled_exception() { throw; }
+    #endif // BOOST_NO_EXCEPTIONS
+
+        // Frame allocation hook (a stateless Allocator is used so that the
+        // operators stay trivially elidable (HALO))
+        static void * operator new( std::size_t const size )
+        {
+            byte_allocator allocator;
+            return std::allocator_traits<byte_allocator>::allocate( allocator, size );
+        }
+        static void operator delete( void * const frame, std::size_t const size ) noexcept
+        {
+            byte_allocator allocator;
+            std::allocator_traits<byte_allocator>::deallocate( allocator, static_cast<std::byte *>( frame ), size );
+        }
+
+        bool succeeded() const noexcept { inspected_ = true; return state_ == state::succeeded; }
+        bool completed() const noexcept { return state_ != state::running  ; }
+
+        bool uninspected_failure() const noexcept { return !inspected_ && state_ == state::failed; }
+
+        template <typename Source>
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        void set_error( Source && __restrict error ) noexcept( std::is_nothrow_constructible_v<Error, Source &&> )
+        {
+            BOOST_ASSERT_MSG( state_ == state::running, "Coroutine already completed." );
+            std::construct_at( &error_, std::forward<Source>( error ) );
+            state_ = state::failed;
+        }
+
+        Error && error() noexcept { BOOST_ASSERT( state_ == state::failed ); return std::move( error_ ); }
+
+    protected:
+        using byte_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::byte>;
+
+        enum struct state : std::uint8_t { running, succeeded, failed };
+
+         coroutine_promise_base() noexcept {}
+        ~coroutine_promise_base() noexcept( std::is_nothrow_destructible_v<Error> ) { if ( state_ == state::failed ) [[ unlikely ]] std::destroy_at( &error_ ); }
+
+        union { Error error_; };
+        state state_{ state::running };
+        mutable bool inspected_{ false };
+    }; // class coroutine_promise_base
+
+    ////////////////////////////////////////////////////////////////////////////
+    // (Non-owning) awaiters: the awaited temporary lives until the end of the
+    // full-expression containing the co_await (i.e. across the suspension).
+    ////////////////////////////////////////////////////////////////////////////
+
+    template <class Result, class Error>
+    struct result_or_error_awaiter
+    {
+        result_or_error<Result, Error> & awaited;
+
+        bool await_ready() const noexcept { return awaited.succeeded(); }
+
+        template <class Promise>
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        void await_suspend( std::coroutine_handle<Promise> const coroutine ) noexcept
+        {
+            // never resumed: the owning fallible_coroutine destroys the frame
+            coroutine.promise().set_error( std::move( awaited ).error() );
+        }
+
+        Result await_resume() noexcept { return std::move( awaited ).assume_succeeded(); }
+    }; // struct result_or_error_awaiter
+
+    // fallible_results first have to 'decay' to result_or_errors (for which
+    // the awaiter has to provide the storage)
+    template <class Result, class Error>
+    struct fallible_result_awaiter
+    {
+        result_or_error<Result, Error> awaited;
+
+        bool await_ready() const noexcept { return awaited.succeeded(); }
+
+        template <class Promise>
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        void await_suspend( std::coroutine_handle<Promise> const coroutine ) noexcept { coroutine.promise().set_error( std::move( awaited ).error() ); }
+
+        Result await_resume() noexcept { return std::move( awaited ).assume_succeeded(); }
+    }; // struct fallible_result_awaiter
+
+    template <class Promise>
+    struct coroutine_awaiter
+    {
+        Promise & awaited;
+
+        bool await_ready() const noexcept { return awaited.succeeded(); }
+
+        template <class AwaitingPromise>
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        void await_suspend( std::coroutine_handle<AwaitingPromise> const coroutine ) noexcept
+        {
+            coroutine.promise().set_error( awaited.error() );
+        }
+
+        decltype( auto ) await_resume() noexcept { return awaited.result(); }
+    }; // struct coroutine_awaiter
+
+    template <class Result, class Error, class Allocator>
+    class coroutine_promise : public coroutine_promise_base<Error, Allocator>
+    {
+    private:
+        using base = coroutine_promise_base<Error, Allocator>;
+
+    public:
+        coroutine_promise() noexcept {}
+        ~coroutine_promise() noexcept( std::is_nothrow_destructible_v<Result> ) { if ( base::succeeded() ) std::destroy_at( &result_ ); }
+
+        fallible_coroutine<Result, Error, Allocator> get_return_object() noexcept;
+
+        template <typename Source> requires detail::preferred_source<Source, Result, Error>
+        void return_value( Source && __restrict result ) noexcept( std::is_nothrow_constructible_v<Result, Source &&> )
+        {
+            BOOST_ASSERT_MSG( this->state_ == base::state::running, "Coroutine already completed." );
+            std::construct_at( &result_, std::forward<Source>( result ) );
+            this->state_ = base::state::succeeded;
+        }
+        template <typename Source> requires detail::preferred_source<Source, Error, Result>
+        void return_value( Source && __restrict error ) noexcept( std::is_nothrow_constructible_v<Error, Source &&> ) { base::set_error( std::forward<Source>( error ) ); }
+        void return_value( Error && error ) noexcept( std::is_nothrow_move_constructible_v<Error> ) { base::set_error( std::move( error ) ); }
+
+        template <class R, class E> auto await_transform( result_or_error<R, E>         && awaited ) noexcept { return result_or_error_awaiter<R, E>{ awaited }; }
+        template <class R, class E> auto await_transform( fallible_result<R, E>         && awaited ) noexcept { return fallible_result_awaiter<R, E>{ std::move( awaited ).as_result_or_error() }; }
+        template <class R, class E, class A>
+        auto await_transform( fallible_coroutine<R, E, A> && awaited ) noexcept { return coroutine_awaiter<coroutine_promise<R, E, A>>{ awaited.promise() }; }
+
+        Result && result() noexcept { BOOST_ASSERT( base::succeeded() ); return std::move( result_ ); }
+
+    private:
+        union { Result result_; };
+    }; // class coroutine_promise
+
+    template <class Error, class Allocator>
+    class coroutine_promise<void, Error, Allocator> : public coroutine_promise_base<Error, Allocator>
+    {
+    private:
+        using base = coroutine_promise_base<Error, Allocator>;
+
+    public:
+        fallible_coroutine<void, Error, Allocator> get_return_object() noexcept;
+
+        void return_void() noexcept
+        {
+            BOOST_ASSERT_MSG( this->state_ == base::state::running, "Coroutine already completed." );
+            this->state_ = base::state::succeeded;
+        }
+
+        template <class R, class E> auto await_transform( result_or_error<R, E>         && awaited ) noexcept { return result_or_error_awaiter<R, E>{ awaited }; }
+        template <class R, class E> auto await_transform( fallible_result<R, E>         && awaited ) noexcept { return fallible_result_awaiter<R, E>{ std::move( awaited ).as_result_or_error() }; }
+        template <class R, class E, class A>
+        auto await_transform( fallible_coroutine<R, E, A> && awaited ) noexcept { return coroutine_awaiter<coroutine_promise<R, E, A>>{ awaited.promise() }; }
+
+        void result() noexcept { BOOST_ASSERT( base::succeeded() ); }
+    }; // class coroutine_promise<void>
+} // namespace detail
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class fallible_coroutine
+///
+/// \brief A (synchronous, eagerly started) coroutine return type for
+/// exception-free error propagation.
+///
+/// \detail Inside the coroutine body co_await-ing a result_or_error,
+/// fallible_result or another fallible_coroutine yields the Result or ends the
+/// coroutine with the Error (nothing is thrown, the coroutine is simply never
+/// resumed). The body co_returns a Result (or an Error).
+/// The returned object is consumed just like a fallible_result: converted to a
+/// fallible_result (i.e. still throwing if left uninspected), a
+/// result_or_error or directly to the Result (throwing on failure) - but a
+/// failure left unconsumed is not thrown (see the destructor).
+/// The frame lives only until the returned object is consumed (within the
+/// caller's full-expression) and is allocated through a stateless Allocator
+/// so that compilers can elide the allocation (HALO).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Result, class Error, class Allocator>
+class [[ nodiscard ]] fallible_coroutine
+{
+public:
+    using promise_type = detail::coroutine_promise<Result, Error, Allocator>;
+
+    fallible_coroutine( fallible_coroutine && other ) noexcept : coroutine_( std::exchange( other.coroutine_, nullptr ) ) {}
+    fallible_coroutine( fallible_coroutine const & ) = delete;
+    /// \note Unlike an uninspected failed fallible_result, a failure that was
+    /// never consumed (nor co_awaited) is not thrown, only asserted against:
+    /// the destructor of a coroutine return object has to be noexcept (it is
+    /// also destroyed by the coroutine 'ramp' if the body throws, and GCC 12
+    /// does not compile coroutines with a throwing one).
+   ~fallible_coroutine() noexcept
+    {
+        if ( coroutine_ )
+        {
+            BOOST_ASSERT_MSG( !coroutine_.promise().uninspected_failure(), "Ignored fallible_coroutine failure." );
+            coroutine_.destroy();
+        }
+    }
+
+    result_or_error<Result, Error> as_result_or_error() && noexcept
+    {
+        auto & promise( this->promise() );
+        if ( BOOST_LIKELY( promise.succeeded() ) )
+        {
+            if constexpr ( std::is_void_v<Result> ) return no_err;
+            else                                    return promise.result();
+        }
+        return detail::make_failed<result_or_error<Result, Error>>( promise.error() );
+    }
+
+    fallible_result<Result, Error> as_fallible_result() && noexcept
+    {
+        auto & promise( this->promise() );
+        if ( BOOST_LIKELY( promise.succeeded() ) )
+        {
+            if constexpr ( std::is_void_v<Result> ) return no_err;
+            else                                    return promise.result();
+        }
+        return detail::make_failed<fallible_result<Result, Error>>( promise.error() );
+    }
+
+    result_or_error<Result, Error> operator()() && noexcept { return std::move( *this ).as_result_or_error(); }
+
+    operator result_or_error<Result, Error>() && noexcept { return std::move( *this ).as_result_or_error(); }
+    operator fallible_result<Result, Error>() && noexcept { return std::move( *this ).as_fallible_result(); }
+
+    /// Exception handling mode (the outermost caller)
+    operator Result() && requires( !std::is_void_v<Result> )
+    {
+        auto & promise( this->promise() );
+        if ( BOOST_UNLIKELY( !promise.succeeded() ) )
+        {
+            auto && error( promise.error() );
+            detail::throw_error( error );
+        }
+        return promise.result();
+    }
+
+private: template <class R, class E, class A> friend class detail::coroutine_promise;
+    explicit fallible_coroutine( std::coroutine_handle<promise_type> const coroutine ) noexcept : coroutine_( coroutine ) {}
+
+    promise_type & promise() const noexcept
+    {
+        BOOST_ASSERT_MSG( coroutine_.promise().completed(), "Coroutine still running." );
+        return coroutine_.promise();
+    }
+
+    std::coroutine_handle<promise_type> coroutine_;
+}; // class fallible_coroutine
+
+
+template <class Result, class Error, class Allocator>
+fallible_coroutine<Result, Error, Allocator> detail::coroutine_promise<Result, Error, Allocator>::get_return_object() noexcept
+{
+    return fallible_coroutine<Result, Error, Allocator>{ std::coroutine_handle<coroutine_promise>::from_promise( *this ) };
+}
+
+template <class Error, class Allocator>
+fallible_coroutine<void, Error, Allocator> detail::coroutine_promise<void, Error, Allocator>::get_return_object() noexcept
+{
+    return fallible_coroutine<void, Error, Allocator>{ std::coroutine_handle<coroutine_promise>::from_promise( *this ) };
+}
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
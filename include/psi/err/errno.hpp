@@ -16,14 +16,18 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include "result_or_error.hpp"
+
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <boost/config_ex.hpp>
 
 #include <cerrno>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <stdexcept>
+#include <exception>
+#include <utility>
 //------------------------------------------------------------------------------
 namespace psi::err
 {
@@ -56,9 +60,11 @@ struct last_errno
     BOOST_ATTRIBUTES( BOOST_MINSIZE, BOOST_RESTRICTED_FUNCTION_L2, BOOST_EXCEPTIONLESS, BOOST_WARN_UNUSED_RESULT )
     static bool       BOOST_CC_REG is() { return is( value ); }
 
-    /// \todo Interferes with result_or_error constructor SFINAE selection
-    /// for Result types constructible from value_type if implicit. Cleanup...
-    ///                                       (27.02.2016.) (Domagoj Saric)
+    /// \note Deliberately explicit: if implicit, an Error source would also
+    /// be a (preferred) Result source for Result types constructible from
+    /// value_type, i.e. the result_or_error constructor selection would be
+    /// ambiguous (e.g. for int Results with traced<> Errors - see
+    /// detail::preferred_source).
     explicit
     operator value_type () const { return value/*get()*/; }
 
@@ -77,20 +83,199 @@ struct last_errno
 #endif // NDEBUG
 }; // struct last_errno
 
+// (no errno value is negative)
+template <> struct sentinel_traits<last_errno> { static last_errno::value_type constexpr unknown_error = -1; };
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class errno_code
+///
+/// \brief An errno value passed around by value (i.e. one that is returned by
+/// the API itself rather than set in the thread-local errno).
+///
+/// \detail For negative-errno syscall conventions (io_uring CQE results, raw
+/// syscalls) and functions that directly return the error code (pthreads,
+/// posix_spawn...) - constructing one never touches (nor possibly captures a
+/// stale value of) the TLS errno. Opts into the sentinel_result_error_variant
+/// layout (e.g. result_or_error<std::size_t, errno_code> is a packed
+/// std::size_t + int pair).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+struct errno_code
+{
+    using value_type = last_errno::value_type;
+
+    static value_type const no_error = 0;
+
+    constexpr explicit errno_code( value_type const code ) noexcept : value( code ) {}
+
+    /// \note See last_errno::operator value_type.
+    explicit constexpr
+    operator value_type () const noexcept { return value; }
+
+    value_type value;
+}; // struct errno_code
+
+template <> struct sentinel_traits<errno_code> { static errno_code::value_type constexpr unknown_error = -1; };
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class current_errno
+///
+/// \brief A stateless view of the calling thread's errno: the value is
+/// (re)read on demand rather than captured on construction (as with
+/// last_errno).
+///
+/// \detail Takes no space, i.e. selects the 'compressed' or the 'niche'
+/// result_or_error layout (e.g. result_or_error<file_handle, current_errno>
+/// with a niche_traits<file_handle> is only the handle and the inspected
+/// flag). The price: a failed result has to be inspected (or converted to a
+/// last_errno) before anything else can clobber errno.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+struct current_errno
+{
+    using value_type = last_errno::value_type;
+
+    static value_type const no_error = 0;
+
+    /// \note See last_errno::operator value_type.
+    explicit
+    operator value_type() const noexcept { return last_errno::get(); }
+
+    /// Captures the current value (e.g. for a result that has to outlive the
+    /// next errno-setting call).
+    operator last_errno() const noexcept { return {}; }
+}; // struct current_errno
+
+static_assert( is_stateless_error<current_errno> );
+static_assert( sizeof( result_or_error<void *, current_errno> ) == sizeof( std::pair<void *, bool> ), "current_errno has to take no space." );
+
+
+namespace detail
+{
+    // XSI (int returning) and GNU (char * returning) strerror_r flavours
+    inline char const * strerror_r_message( int          const result , char const * const buffer ) noexcept { return ( result == 0 ) ? buffer : nullptr; }
+    inline char const * strerror_r_message( char const * const message, char const *              ) noexcept { return message; }
+
+    class errno_messages
+    {
+    public:
+        static std::uint16_t constexpr table_size     = 160;
+        static std::uint8_t  constexpr message_length =  64;
+
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        static char const * BOOST_CC_REG get( last_errno::value_type const code ) noexcept
+        {
+            static errno_messages const table; // 'magic static': lock-free access after initialisation
+            if ( static_cast<unsigned>( code ) < table_size && table.messages_[ code ][ 0 ] )
+                return table.messages_[ code ];
+            return "Unknown error";
+        }
+
+    private:
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        errno_messages() noexcept
+        {
+            for ( int code{ 1 }; code < table_size; ++code )
+            {
+                auto & message( messages_[ code ] );
+            #if defined( _MSC_VER )
+                if ( ::strerror_s( message, sizeof( message ), code ) != 0 )
+                    message[ 0 ] = '\0';
+            #else
+                auto const source( strerror_r_message( ::strerror_r( code, message, sizeof( message ) ), message ) );
+                if ( !source )
+                    message[ 0 ] = '\0';
+                else
+                if ( source != message ) // GNU strerror_r may return a static string
+                {
+                    std::strncpy( message, source, sizeof( message ) - 1 );
+                    message[ sizeof( message ) - 1 ] = '\0';
+                }
+            #endif // _MSC_VER
+            }
+        }
+
+        char messages_[ table_size ][ message_length ] = {};
+    }; // class errno_messages
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class errno_error
+///
+/// \brief The exception thrown for last_errno and errno_code errors.
+///
+/// \detail Stores only the error code - what() points into a process-wide
+/// table of messages (populated with strerror_r on first use) so neither
+/// construction nor what() ever allocate (nor race on std::strerror's static
+/// buffer).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+class errno_error : public std::exception
+{
+public:
+    using value_type = last_errno::value_type;
+
+    explicit errno_error( value_type const code ) noexcept : code_( code ) {}
+
+    value_type code() const noexcept { return code_; }
+
+    char const * what() const noexcept override { return detail::errno_messages::get( code_ ); }
+
+private:
+    value_type code_;
+}; // class errno_error
+
 
-#if defined( BOOST_MSVC )
-#   pragma warning( push )
-#   pragma warning( disable : 4996 ) // "The POSIX name for this item is deprecated. Instead, use the ISO C++ conformant name."
-#endif // BOOST_MSVC
 inline BOOST_ATTRIBUTES( BOOST_COLD )
-std::runtime_error BOOST_CC_REG make_exception( last_errno const error )
+errno_error BOOST_CC_REG make_exception( last_errno const error ) noexcept
 {
     BOOST_ASSERT_MSG( error.value != last_errno::no_error, "Throwing on no error?" );
-    return std::runtime_error( std::strerror( error.value ) );
+    return errno_error( error.value );
+}
+
+inline BOOST_ATTRIBUTES( BOOST_COLD )
+errno_error BOOST_CC_REG make_exception( errno_code const error ) noexcept
+{
+    BOOST_ASSERT_MSG( error.value != errno_code::no_error, "Throwing on no error?" );
+    return errno_error( error.value );
+}
+
+inline BOOST_ATTRIBUTES( BOOST_COLD )
+errno_error BOOST_CC_REG make_exception( current_errno const error ) noexcept
+{
+    // (errno may have been cleared in the mean time - a failure is a failure)
+    auto const value( static_cast<current_errno::value_type>( error ) );
+    return errno_error( ( value != current_errno::no_error ) ? value : sentinel_traits<last_errno>::unknown_error );
+}
+
+
+/// Negative-errno return convention (raw syscalls, io_uring CQE results):
+/// >= 0 - the (byte count) Result, < 0 - the negated errno.
+inline
+result_or_error<std::size_t, errno_code> BOOST_CC_REG from_negative_errno( std::ptrdiff_t const return_value ) noexcept
+{
+    using result = result_or_error<std::size_t, errno_code>;
+    if ( return_value >= 0 ) [[ likely ]]
+        return result( std::in_place, static_cast<std::size_t>( return_value ) );
+    return result( std::in_place_type<errno_code>, static_cast<errno_code::value_type>( -return_value ) );
+}
+
+/// Functions that return the error code itself (0 on success - e.g. pthreads).
+inline
+void_or_error<errno_code> BOOST_CC_REG from_returned_errno( errno_code::value_type const return_value ) noexcept
+{
+    if ( return_value == errno_code::no_error ) [[ likely ]]
+        return no_err;
+    return void_or_error<errno_code>( std::in_place_type<errno_code>, return_value );
 }
-#if defined( BOOST_MSVC )
-#   pragma warning( pop )
-#endif // BOOST_MSVC
 
 //------------------------------------------------------------------------------
 } // namespace psi::err
@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file error_code.hpp
+/// --------------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "errno.hpp"
+#include "exceptions.hpp"
+#ifdef _WIN32
+#include "win32.hpp"
+#endif // _WIN32
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <type_traits>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// std::error_code interoperability
+/// --------------------------------
+///
+/// \brief Conversions between the psi::err Errors and std::error_code (for
+/// the boundaries with Asio, std::filesystem & co.) and std::error_code as a
+/// psi::err Error in its own right.
+///
+/// \detail
+///  - last_errno, errno_code (and last_win32_error) implicitly convert to
+/// std::error_code (through make_error_code() and std::is_error_code_enum).
+/// The codes use psi::err's own categories: constant initialised, never
+/// destroyed singletons - creating a code is just storing the value and the
+/// (link time constant) address of the category (no function-local static
+/// guard, no call). The categories map their codes to the std::generic_category()
+/// (respectively, on Windows, the std::system_category()) conditions so
+/// comparisons against std::errc values keep working.
+///  - to_errno_code() (and to_win32_error()) go the other way: the fast path
+/// is a (non-virtual) category identity check - the virtual
+/// default_error_condition() is consulted only for codes of other categories.
+///  - result_or_error<T, std::error_code> (and fallible_result<T,
+/// std::error_code>) are supported as is: the success path never touches the
+/// category while throwing makes a std::system_error (i.e. its message is
+/// formatted, and allocated, only when actually throwing).
+/// Usage:
+///     std::error_code const code{ last_errno{} };
+///     auto const error( to_errno_code( filesystem_error.code() ) );
+///
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+    // constant initialised (i.e. no guard nor initialisation order issues)
+    // and never destroyed (codes may still be used by the destructors of other
+    // static objects)
+    template <class Category>
+    union immortal
+    {
+        constexpr immortal() noexcept : object() {}
+                 ~immortal() noexcept {}
+
+        Category object;
+    }; // union immortal
+
+    class errno_category_t final : public std::error_category
+    {
+    public:
+        constexpr errno_category_t() noexcept = default;
+
+        char const * name() const noexcept override { return "psi::err::errno"; }
+
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        std::string message( int const code ) const override { return errno_messages::get( code ); }
+
+        std::error_condition default_error_condition( int const code ) const noexcept override { return { code, std::generic_category() }; }
+    }; // class errno_category_t
+
+    inline constinit immortal<errno_category_t> const errno_category_instance;
+
+    // codes of foreign categories (e.g. an Asio misc error): through their
+    // std::errc equivalent, if any
+    BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+    inline errno_code BOOST_CC_REG errno_equivalent( std::error_code const & code ) noexcept
+    {
+        if ( !code )
+            return errno_code( errno_code::no_error );
+        auto const condition( code.default_error_condition() );
+        if ( condition.category() == std::generic_category() )
+            return errno_code( condition.value() );
+        return errno_code( EIO );
+    }
+} // namespace detail
+
+
+inline std::error_category const & errno_category() noexcept { return detail::errno_category_instance.object; }
+
+inline std::error_code make_error_code( errno_code const error ) noexcept { return { error.value, errno_category() }; }
+inline std::error_code make_error_code( last_errno const error ) noexcept { return { error.value, errno_category() }; }
+
+/// Whether the code holds an errno value: our own, the generic and (on POSIX
+/// systems) the system category.
+inline bool is_errno( std::error_code const & code ) noexcept
+{
+    auto const & category( code.category() );
+    return
+        ( category == errno_category()        ) ||
+    #ifndef _WIN32
+        ( category == std::system_category()  ) ||
+    #endif // _WIN32
+        ( category == std::generic_category() );
+}
+
+/// \note Lossy for codes of categories without an errno equivalent: those
+/// become EIO.
+inline errno_code to_errno_code( std::error_code const & code ) noexcept
+{
+    if ( is_errno( code ) ) [[ likely ]]
+        return errno_code( code.value() );
+    return detail::errno_equivalent( code );
+}
+
+
+#ifdef _WIN32
+namespace detail
+{
+    class win32_category_t final : public std::error_category
+    {
+    public:
+        constexpr win32_category_t() noexcept = default;
+
+        char const * name() const noexcept override { return "psi::err::win32"; }
+
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        std::string message( int const code ) const override { return system_messages.get( static_cast<last_win32_error::value_type>( code ) ); }
+
+        std::error_condition default_error_condition( int const code ) const noexcept override { return std::system_category().default_error_condition( code ); }
+    }; // class win32_category_t
+
+    inline constinit immortal<win32_category_t> const win32_category_instance;
+} // namespace detail
+
+inline std::error_category const & win32_category() noexcept { return detail::win32_category_instance.object; }
+
+inline std::error_code make_error_code( last_win32_error const error ) noexcept { return { static_cast<int>( error.value ), win32_category() }; }
+
+/// Whether the code holds a Win32 error: our own and the system category.
+inline bool is_win32( std::error_code const & code ) noexcept
+{
+    auto const & category( code.category() );
+    return ( category == win32_category() ) || ( category == std::system_category() );
+}
+
+/// \note Codes of other categories become ERROR_UNIDENTIFIED_ERROR.
+inline last_win32_error to_win32_error( std::error_code const & code ) noexcept
+{
+    if ( is_win32( code ) || !code ) [[ likely ]]
+        return { static_cast<last_win32_error::value_type>( code.value() ) };
+    return { ERROR_UNIDENTIFIED_ERROR };
+}
+#endif // _WIN32
+
+
+namespace detail
+{
+    template <>
+    struct foreign_exception<std::error_code>
+    {
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        static std::system_error BOOST_CC_REG make( std::error_code const & error )
+        {
+            BOOST_ASSERT_MSG( error, "Throwing on no error?" );
+            return std::system_error( error );
+        }
+    }; // struct foreign_exception<std::error_code>
+} // namespace detail
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
+
+template <> struct std::is_error_code_enum<psi::err::errno_code      > : std::true_type {};
+template <> struct std::is_error_code_enum<psi::err::last_errno      > : std::true_type {};
+#ifdef _WIN32
+template <> struct std::is_error_code_enum<psi::err::last_win32_error> : std::true_type {};
+#endif // _WIN32
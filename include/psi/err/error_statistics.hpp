@@ -0,0 +1,250 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file error_statistics.hpp
+/// --------------------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <boost/config_ex.hpp>
+#include <boost/current_function.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <source_location>
+#include <type_traits>
+#include <vector>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Error statistics (PSI_ERR_ERROR_STATISTICS)
+/// -------------------------------------------
+///
+/// \brief Opt-in, per-thread failure counters keyed by Error type, error
+/// value and the source location of the error construction.
+///
+/// \detail With PSI_ERR_ERROR_STATISTICS defined to 1 every (cold) error
+/// construction of a result_or_error/fallible_result and every throw_error()
+/// bumps a counter in a table owned by the current thread (a TLS access, a
+/// short probe and a plain, uncontended, store - no RMW, no shared cache
+/// lines). Nothing is added to the success paths and everything is compiled
+/// out when disabled (the default).
+/// error_statistics() aggregates a (relaxed, i.e. possibly slightly
+/// lagging) snapshot over all the (live and past) threads, e.g. for exporting
+/// to a metrics system. Counters are cumulative (the tables of exited threads
+/// are recycled, not reset).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+struct error_statistic
+{
+    char const *         error_type ; ///< (compiler specific) pretty function name containing the Error type
+    std::int64_t         error_value; ///< Error::value_type value (0 for Errors w/o one)
+    std::source_location location   ; ///< of the error construction (empty for throws and in_place constructions)
+    std::uint64_t        failures   ; ///< constructed errors
+    std::uint64_t        throws     ; ///< thrown errors
+}; // struct error_statistic
+
+namespace detail
+{
+    // (source_location::function_name() does not include template arguments
+    // with all compilers)
+    template <class Error>
+    char const * error_type_name() noexcept { return BOOST_CURRENT_FUNCTION; }
+
+    template <class Error>
+    std::int64_t error_value( Error const & error ) noexcept
+    {
+        if constexpr ( requires { static_cast<typename Error::value_type>( error ); } )
+            return static_cast<std::int64_t>( static_cast<typename Error::value_type>( error ) );
+        else
+            return 0;
+    }
+
+    class error_counters
+    {
+    public:
+        enum struct kind : std::uint8_t { failure, throw_ };
+
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        static void BOOST_CC_REG record( char const * const type, std::int64_t const value, std::source_location const & location, kind const what ) noexcept
+        {
+            auto * const table( local() );
+            if ( BOOST_UNLIKELY( !table ) )
+                return;
+            auto & counter( table->find( type, value, location ) );
+            auto & count  ( what == kind::failure ? counter.failures : counter.throws );
+            count.store( count.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed ); // owner-thread-only writes
+        }
+
+        template <typename Visitor>
+        static void visit( Visitor && visitor ) noexcept( noexcept( visitor( std::declval<error_statistic const &>() ) ) )
+        {
+            for ( auto * table{ tables().load( std::memory_order_acquire ) }; table; table = table->next_ )
+            {
+                for ( auto const & counter : table->counters_ )
+                {
+                    auto const type( counter.type.load( std::memory_order_acquire ) );
+                    if ( !type )
+                        continue;
+                    visitor( error_statistic{ type, counter.value, counter.location, counter.failures.load( std::memory_order_relaxed ), counter.throws.load( std::memory_order_relaxed ) } );
+                }
+            }
+        }
+
+    private:
+        struct alignas( 64 ) counter
+        {
+            std::atomic<char const *>  type{ nullptr }; // published last (release)
+            std::int64_t               value{ 0 };
+            std::source_location       location;
+            std::atomic<std::uint64_t> failures{ 0 };
+            std::atomic<std::uint64_t> throws  { 0 };
+        }; // struct counter
+
+        static std::uint16_t constexpr capacity = 128;
+
+        counter & find( char const * const type, std::int64_t const value, std::source_location const & location ) noexcept
+        {
+            auto hash( ( reinterpret_cast<std::uintptr_t>( type ) >> 4 ) ^ static_cast<std::uintptr_t>( value ) * 2654435761U ^ reinterpret_cast<std::uintptr_t>( location.file_name() ) ^ location.line() * 40503U );
+            for ( std::uint16_t probe{ 0 }; probe < capacity - 1; ++probe, ++hash )
+            {
+                auto & candidate( counters_[ hash % ( capacity - 1 ) ] );
+                auto const existing( candidate.type.load( std::memory_order_relaxed ) );
+                if ( !existing )
+                {
+                    candidate.value    = value;
+                    candidate.location = location;
+                    candidate.type.store( type, std::memory_order_release );
+                    return candidate;
+                }
+                if
+                (
+                    existing                      == type                 &&
+                    candidate.value               == value                &&
+                    candidate.location.line()     == location.line()      &&
+                    candidate.location.column()   == location.column()    &&
+                    candidate.location.file_name() == location.file_name()
+                )
+                    return candidate;
+            }
+            // table full: account in the last, 'overflow', slot
+            auto & overflow( counters_[ capacity - 1 ] );
+            if ( !overflow.type.load( std::memory_order_relaxed ) )
+                overflow.type.store( "<overflow>", std::memory_order_release );
+            return overflow;
+        }
+
+        static std::atomic<error_counters *> & tables() noexcept
+        {
+            static constinit std::atomic<error_counters *> list{ nullptr };
+            return list;
+        }
+
+        // adopt a table of an exited thread or allocate (and publish) a new one
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        static error_counters * acquire() noexcept
+        {
+            for ( auto * table{ tables().load( std::memory_order_acquire ) }; table; table = table->next_ )
+            {
+                bool expected{ false };
+                if ( !table->in_use_.load( std::memory_order_relaxed ) && table->in_use_.compare_exchange_strong( expected, true, std::memory_order_acquire ) )
+                    return table;
+            }
+            auto * const table( new ( std::nothrow ) error_counters );
+            if ( !table )
+                return nullptr;
+            table->next_ = tables().load( std::memory_order_relaxed );
+            while ( !tables().compare_exchange_weak( table->next_, table, std::memory_order_release, std::memory_order_relaxed ) ) {}
+            return table;
+        }
+
+        struct owner
+        {
+            error_counters * table{ acquire() };
+           ~owner() noexcept { if ( table ) table->in_use_.store( false, std::memory_order_release ); }
+        }; // struct owner
+
+        static error_counters * local() noexcept
+        {
+            thread_local owner const current;
+            return current.table;
+        }
+
+        error_counters() noexcept = default;
+
+        counter                    counters_[ capacity ];
+        error_counters *           next_  { nullptr };
+        std::atomic<bool>          in_use_{ true    };
+    }; // class error_counters
+
+    template <class Error>
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    void count_failure( Error const & error, std::source_location const & location ) noexcept
+    {
+        error_counters::record( error_type_name<Error>(), error_value( error ), location, error_counters::kind::failure );
+    }
+
+    template <class Error>
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    void count_throw( Error const & error ) noexcept
+    {
+        error_counters::record( error_type_name<Error>(), error_value( error ), {}, error_counters::kind::throw_ );
+    }
+} // namespace detail
+
+
+/// Calls visitor( error_statistic const & ) for every counter of every thread
+/// (i.e. the same key can be visited multiple times - see error_statistics()).
+template <typename Visitor>
+void visit_error_statistics( Visitor && visitor ) { detail::error_counters::visit( visitor ); }
+
+/// The aggregated (over all threads) snapshot.
+inline std::vector<error_statistic> error_statistics()
+{
+    std::vector<error_statistic> statistics;
+    visit_error_statistics
+    (
+        [ & ]( error_statistic const & counter )
+        {
+            for ( auto & aggregate : statistics )
+            {
+                if
+                (
+                    !std::strcmp( aggregate.error_type, counter.error_type )           &&
+                    aggregate.error_value            == counter.error_value            &&
+                    aggregate.location.line()        == counter.location.line()        &&
+                    aggregate.location.column()      == counter.location.column()      &&
+                    !std::strcmp( aggregate.location.file_name(), counter.location.file_name() ) // (string literals are not necessarily merged across TUs)
+                )
+                {
+                    aggregate.failures += counter.failures;
+                    aggregate.throws   += counter.throws  ;
+                    return;
+                }
+            }
+            statistics.push_back( counter );
+        }
+    );
+    return statistics;
+}
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
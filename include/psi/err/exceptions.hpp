@@ -22,6 +22,10 @@
 #include <boost/throw_exception.hpp>
 
 #include <exception>
+#ifdef BOOST_NO_EXCEPTIONS
+#include <atomic>
+#include <cstdlib>
+#endif // BOOST_NO_EXCEPTIONS
 #include <type_traits>
 #include <utility>
 
@@ -40,6 +44,48 @@ namespace err
 
 BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
 
+////////////////////////////////////////////////////////////////////////////////
+///
+/// No-exceptions mode (BOOST_NO_EXCEPTIONS)
+/// ----------------------------------------
+///
+/// Everything that would otherwise throw (an uninspected failed
+/// fallible_result, a failed conversion to Result, throw_if_error()...) calls
+/// the installed failure handler instead (with the 'would be thrown' exception
+/// object - or nullptr if it is not derived from std::exception). The handler
+/// must not return (abort, log and abort, longjmp into a supervisor...) -
+/// std::abort() is called if it does (or if none is installed).
+/// All the psi::err destructors are noexcept in this mode.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef BOOST_NO_EXCEPTIONS
+#   define PSI_ERR_NOEXCEPT_UNLESS_EXCEPTIONS noexcept( true  )
+#else
+#   define PSI_ERR_NOEXCEPT_UNLESS_EXCEPTIONS noexcept( false )
+#endif // BOOST_NO_EXCEPTIONS
+
+#ifdef BOOST_NO_EXCEPTIONS
+using failure_handler = void ( * )( std::exception const * exception ) noexcept;
+
+namespace detail
+{
+    inline constinit std::atomic<failure_handler> installed_failure_handler{ nullptr };
+
+    [[ noreturn ]] inline BOOST_ATTRIBUTES( BOOST_COLD )
+    void BOOST_CC_REG invoke_failure_handler( std::exception const * const exception ) noexcept
+    {
+        if ( auto const handler{ installed_failure_handler.load( std::memory_order_acquire ) } )
+            handler( exception );
+        std::abort();
+    }
+} // namespace detail
+
+/// Returns the previously installed handler.
+inline failure_handler set_failure_handler( failure_handler const handler ) noexcept { return detail::installed_failure_handler.exchange( handler, std::memory_order_acq_rel ); }
+inline failure_handler get_failure_handler(                              ) noexcept { return detail::installed_failure_handler.load    (          std::memory_order_acquire ); }
+#endif // BOOST_NO_EXCEPTIONS
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 // boost::err::make_exception()
@@ -59,20 +105,48 @@ BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
 template <class Error>
 Error && make_exception( Error && error ) { return std::forward<Error>( error ); }
 
+namespace detail
+{
+    /// Customisation point for 'foreign' Error types (i.e. from namespaces
+    /// which ADL cannot reach from here - e.g. std::error_code, see
+    /// error_code.hpp): specialisations provide a static make( Error ).
+    template <class Error>
+    struct foreign_exception {};
+} // namespace detail
+
+template <class Error>
+requires requires( Error && error ) { detail::foreign_exception<std::remove_cvref_t<Error>>::make( std::forward<Error>( error ) ); }
+auto make_exception( Error && error ) { return detail::foreign_exception<std::remove_cvref_t<Error>>::make( std::forward<Error>( error ) ); }
+
 
 template <class Exception>
 [[ noreturn ]] BOOST_ATTRIBUTES( BOOST_COLD )
 void BOOST_CC_REG throw_exception( Exception && exception ) requires( !std::is_fundamental_v<Exception> )
 {
+#ifdef BOOST_NO_EXCEPTIONS
+    if constexpr ( std::convertible_to<Exception, std::exception const &> )
+        detail::invoke_failure_handler( &static_cast<std::exception const &>( exception ) );
+    else
+        detail::invoke_failure_handler( nullptr );
+#else
     if constexpr ( std::convertible_to<Exception, std::exception const &> )
         BOOST_THROW_EXCEPTION( std::forward<Exception>( exception ) );
     else
         throw std::forward<Exception>( exception );
+#endif // BOOST_NO_EXCEPTIONS
 }
 
 template <typename Exception>
 [[noreturn]] BOOST_ATTRIBUTES( BOOST_COLD )
-void BOOST_CC_REG throw_exception( Exception const exception ) requires( std::is_fundamental_v<Exception> ) { throw exception; }
+void BOOST_CC_REG throw_exception( Exception const exception ) requires( std::is_fundamental_v<Exception> )
+{
+#ifdef BOOST_NO_EXCEPTIONS
+    static_cast<void>( exception );
+    detail::invoke_failure_handler( nullptr );
+#else
+    throw exception;
+#endif // BOOST_NO_EXCEPTIONS
+}
 
 template <typename Error>
 [[noreturn]] BOOST_ATTRIBUTES( BOOST_COLD )
@@ -0,0 +1,312 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file execution.hpp
+/// -------------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "fallible_result.hpp"
+#include "result_or_error.hpp"
+#include "settled_result.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#if __has_include( <stdexec/execution.hpp> )
+#include <stdexec/execution.hpp>
+#else
+#error "psi/err/execution.hpp requires the P2300 reference implementation (stdexec)."
+#endif
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Sender/receiver (P2300) adapters
+/// --------------------------------
+///
+/// \brief unpack_result: a sender of a result_or_error<T, E>, fallible_result
+/// <T, E> or settled_result<T, E> value becomes a sender that completes with
+/// set_value( T ) or set_error( E ) - the Error is passed on by value (inline,
+/// in the receiver call) - there is no std::exception_ptr (i.e. no allocation
+/// and no throw) on the error path.
+/// as_result<E>: the reverse - set_value( T... ) and set_error( E ) of a
+/// sender become a set_value( settled_result<T, E> ) (any other errors and
+/// set_stopped are passed through).
+/// sync_wait_fallible<E>: the synchronous boundary - returns a
+/// fallible_result<T, E> (i.e. the usual 'cannot be accidentally ignored'
+/// contract) instead of having sync_wait throw the Error.
+///
+/// \detail All three are pipeable:
+///     auto result{ psi::err::sync_wait_fallible<errno_code>( scheduler.schedule() | stdexec::then( read_block ) | psi::err::unpack_result() | stdexec::then( parse ) ) };
+/// settled_result is used for the values (rather than result_or_error) as
+/// sender adaptors are free to move (and store) values while result_or_error
+/// and fallible_result are deliberately not movable (by users).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+    namespace execution = ::stdexec;
+
+    template <class From, class To>
+    using copy_cvref_t = std::conditional_t
+    <
+        std::is_lvalue_reference_v<From>,
+        std::conditional_t<std::is_const_v<std::remove_reference_t<From>>, To const &, To &>,
+        std::conditional_t<std::is_const_v<std::remove_reference_t<From>>, To const &&, To &&>
+    >;
+
+    template <class Outcome>
+    struct outcome_traits : result_traits<Outcome> {};
+
+    template <class Result, class Error>
+    struct outcome_traits<settled_result<Result, Error>>
+    {
+        using result = Result;
+        using error  = Error ;
+    };
+
+    template <class ... Values>
+    struct unpacked_signatures
+    {
+        static_assert( sizeof...( Values ) == 1, "unpack_result requires senders of a single (result_or_error, fallible_result or settled_result) value." );
+    };
+
+    template <class Outcome>
+    struct unpacked_signatures<Outcome>
+    {
+        using traits = outcome_traits<std::remove_cvref_t<Outcome>>;
+        using result = typename traits::result;
+        using error  = typename traits::error ;
+
+        static bool constexpr nothrow{ ( std::is_void_v<result> || std::is_nothrow_move_constructible_v<result> ) && std::is_nothrow_move_constructible_v<error> };
+
+        using type = std::conditional_t
+        <
+            nothrow,
+            execution::completion_signatures<std::conditional_t<std::is_void_v<result>, execution::set_value_t(), execution::set_value_t( result )>, execution::set_error_t( error )>,
+            execution::completion_signatures<std::conditional_t<std::is_void_v<result>, execution::set_value_t(), execution::set_value_t( result )>, execution::set_error_t( error ), execution::set_error_t( std::exception_ptr )>
+        >;
+    }; // struct unpacked_signatures
+
+    template <class ... Values>
+    using unpacked_signatures_t = typename unpacked_signatures<Values...>::type;
+
+    // inspects the outcome (exactly once) and completes the receiver with
+    // either the Result or the Error
+    template <class Receiver, class Outcome>
+    void complete_unpacked( Receiver && receiver, Outcome & outcome ) noexcept
+    {
+        using outcome_t = std::remove_cvref_t<Outcome>;
+        auto const complete
+        {
+            [ & ]( auto & source )
+            {
+                using result = typename outcome_traits<outcome_t>::result;
+                if ( source.succeeded() ) [[ likely ]]
+                {
+                    if constexpr ( std::is_void_v<result> )                                     execution::set_value( std::move( receiver ) );
+                    else if constexpr ( requires { std::move( source ).assume_succeeded(); } ) execution::set_value( std::move( receiver ), std::move( source ).assume_succeeded() );
+                    else                                                                        execution::set_value( std::move( receiver ), std::move( source ).result() ); // settled_result
+                }
+                else
+                    execution::set_error( std::move( receiver ), std::move( source ).error() );
+            }
+        };
+    #ifndef BOOST_NO_EXCEPTIONS
+        try {
+    #endif // BOOST_NO_EXCEPTIONS
+        if constexpr ( requires { result_traits<outcome_t>::source( outcome ); } ) complete( result_traits<outcome_t>::source( outcome ) );
+        else                                                                       complete( outcome ); // settled_result
+    #ifndef BOOST_NO_EXCEPTIONS
+        } catch ( ... ) { execution::set_error( std::move( receiver ), std::current_exception() ); }
+    #endif // BOOST_NO_EXCEPTIONS
+    }
+
+    template <class Receiver>
+    struct unpack_receiver
+    {
+        using receiver_concept = execution::receiver_t;
+
+        template <class Outcome>
+        void set_value( Outcome && outcome ) && noexcept { complete_unpacked( std::move( receiver ), outcome ); }
+        template <class E>
+        void set_error( E && error ) && noexcept { execution::set_error( std::move( receiver ), std::forward<E>( error ) ); }
+        void set_stopped() && noexcept { execution::set_stopped( std::move( receiver ) ); }
+
+        decltype( auto ) get_env() const noexcept { return execution::get_env( receiver ); }
+
+        Receiver receiver;
+    }; // struct unpack_receiver
+
+    template <class Child>
+    struct unpack_sender
+    {
+        using sender_concept = execution::sender_t;
+
+        template <class Self, class Env>
+        using signatures = execution::transform_completion_signatures_of<copy_cvref_t<Self, Child>, Env, execution::completion_signatures<>, unpacked_signatures_t>;
+
+        template <class Env> auto get_completion_signatures( Env && ) &&      -> signatures<unpack_sender       &&, Env> { return {}; }
+        template <class Env> auto get_completion_signatures( Env && ) const & -> signatures<unpack_sender const &, Env> { return {}; }
+
+        template <class Receiver>
+        auto connect( Receiver receiver ) && { return execution::connect( std::move( child ), unpack_receiver<Receiver>{ std::move( receiver ) } ); }
+        template <class Receiver>
+        auto connect( Receiver receiver ) const & { return execution::connect( child, unpack_receiver<Receiver>{ std::move( receiver ) } ); }
+
+        decltype( auto ) get_env() const noexcept { return execution::get_env( child ); }
+
+        Child child;
+    }; // struct unpack_sender
+
+
+    template <class Error>
+    struct as_result_signatures
+    {
+        template <class ... Values>
+        using value = execution::completion_signatures<>; // (replaced by the settled_result value)
+
+        template <class E>
+        using error = std::conditional_t<std::is_same_v<std::remove_cvref_t<E>, Error>, execution::completion_signatures<>, execution::completion_signatures<execution::set_error_t( E )>>;
+    }; // struct as_result_signatures
+
+    template <class ... Values>
+    struct single_value
+    {
+        static_assert( sizeof...( Values ) <= 1, "as_result requires senders of (at most) a single value." );
+        using type = void;
+    };
+    template <class Value>
+    struct single_value<Value> { using type = std::remove_cvref_t<Value>; };
+
+    template <class ... Values>
+    using single_value_t = typename single_value<Values...>::type;
+
+    template <class Sender, class Env>
+    using sent_value_t = execution::value_types_of_t<Sender, Env, single_value_t, single_value_t>;
+
+    template <class Result, class Error, class Receiver>
+    struct as_result_receiver
+    {
+        using receiver_concept = execution::receiver_t;
+        using settled          = settled_result<Result, Error>;
+
+        template <class ... Values>
+        void set_value( Values && ... values ) && noexcept
+        {
+            execution::set_value( std::move( receiver ), settled( std::in_place, std::forward<Values>( values )... ) );
+        }
+        template <class E>
+        void set_error( E && error ) && noexcept
+        {
+            if constexpr ( std::is_same_v<std::remove_cvref_t<E>, Error> ) execution::set_value( std::move( receiver ), settled( std::in_place_type<Error>, std::forward<E>( error ) ) );
+            else                                                          execution::set_error( std::move( receiver ), std::forward<E>( error ) );
+        }
+        void set_stopped() && noexcept { execution::set_stopped( std::move( receiver ) ); }
+
+        decltype( auto ) get_env() const noexcept { return execution::get_env( receiver ); }
+
+        Receiver receiver;
+    }; // struct as_result_receiver
+
+    template <class Error, class Child>
+    struct as_result_sender
+    {
+        using sender_concept = execution::sender_t;
+
+        template <class Env>
+        using signatures = execution::transform_completion_signatures_of
+        <
+            Child, Env,
+            execution::completion_signatures<execution::set_value_t( settled_result<sent_value_t<Child, Env>, Error> )>,
+            as_result_signatures<Error>::template value,
+            as_result_signatures<Error>::template error
+        >;
+
+        template <class Env> auto get_completion_signatures( Env && ) && -> signatures<Env> { return {}; }
+
+        template <class Receiver>
+        auto connect( Receiver receiver ) &&
+        {
+            using result = sent_value_t<Child, execution::env_of_t<Receiver>>;
+            return execution::connect( std::move( child ), as_result_receiver<result, Error, Receiver>{ std::move( receiver ) } );
+        }
+
+        decltype( auto ) get_env() const noexcept { return execution::get_env( child ); }
+
+        Child child;
+    }; // struct as_result_sender
+
+    // pipe support: sender | adaptor()
+    template <class Adaptor>
+    struct adaptor_closure
+    {
+        template <execution::sender Sender>
+        friend auto operator|( Sender && sender, adaptor_closure const closure ) { return closure.adaptor( std::forward<Sender>( sender ) ); }
+
+        Adaptor adaptor;
+    }; // struct adaptor_closure
+} // namespace detail
+
+
+struct unpack_result_t
+{
+    template <detail::execution::sender Sender>
+    auto operator()( Sender && sender ) const { return detail::unpack_sender<std::remove_cvref_t<Sender>>{ std::forward<Sender>( sender ) }; }
+    auto operator()() const noexcept { return detail::adaptor_closure<unpack_result_t>{ *this }; }
+}; // struct unpack_result_t
+inline unpack_result_t constexpr unpack_result{};
+
+template <class Error>
+struct as_result_t
+{
+    template <detail::execution::sender Sender>
+    auto operator()( Sender && sender ) const { return detail::as_result_sender<Error, std::remove_cvref_t<Sender>>{ std::forward<Sender>( sender ) }; }
+    auto operator()() const noexcept { return detail::adaptor_closure<as_result_t>{ *this }; }
+}; // struct as_result_t
+template <class Error>
+inline as_result_t<Error> constexpr as_result{};
+
+
+/// The synchronous boundary: the Error (sent through set_error) is returned in
+/// a fallible_result (that throws if left uninspected), exception_ptr errors
+/// are rethrown (as with sync_wait). Stopped completions have to be mapped to
+/// an Error beforehand (e.g. with stopped_as_error).
+template <class Error, detail::execution::sender Sender>
+auto sync_wait_fallible( Sender && sender )
+{
+    namespace execution = detail::execution;
+    using result = detail::sent_value_t<std::remove_cvref_t<Sender>, execution::env<>>;
+    static_assert
+    (
+        !execution::sends_stopped<std::remove_cvref_t<Sender>, execution::env<>>,
+        "sync_wait_fallible: map set_stopped to an Error first (e.g. with stdexec::stopped_as_error)."
+    );
+
+    auto completion{ execution::sync_wait( as_result<Error>( std::forward<Sender>( sender ) ) ) };
+    BOOST_ASSUME( completion.has_value() );
+    return fallible_result<result, Error>( std::move( std::get<0>( *completion ) ).as_result_or_error() );
+}
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
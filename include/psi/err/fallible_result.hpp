@@ -21,16 +21,52 @@
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 
-#ifndef NDEBUG
+////////////////////////////////////////////////////////////////////////////////
+///
+/// fallible_result usage sanitizer configuration
+/// ---------------------------------------------
+///
+/// - PSI_ERR_SANITIZER: enables the (per-thread) checks for uninspected and
+///   coexisting fallible_results (defaults to 1 in debug/!NDEBUG builds - it
+///   can also be enabled in optimised, e.g. canary, builds)
+/// - PSI_ERR_SANITIZER_SAMPLING_PERIOD: check only every Nth (power of two)
+///   group of coexisting fallible_results (every instance is still counted -
+///   only the reporting is sampled, so a group cannot get split), 1 - check
+///   all
+///
+/// Violations are reported, with the source location of the offending
+/// construction, through the installed sanitizer_report_handler (by default:
+/// printed to stderr followed by an assertion failure).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PSI_ERR_SANITIZER
+#   ifdef NDEBUG
+#       define PSI_ERR_SANITIZER 0
+#   else
+#       define PSI_ERR_SANITIZER 1
+#   endif // NDEBUG
+#endif // PSI_ERR_SANITIZER
+
+#ifndef PSI_ERR_SANITIZER_SAMPLING_PERIOD
+#   define PSI_ERR_SANITIZER_SAMPLING_PERIOD 1
+#endif // PSI_ERR_SANITIZER_SAMPLING_PERIOD
+
+#if PSI_ERR_SANITIZER
+#include <cstdio>
 #include <exception>
 #ifdef __APPLE__
 #include <Availability.h>
 #include <TargetConditionals.h>
 #endif
-#endif // !NDEBUG
+#endif // PSI_ERR_SANITIZER
 
+#include <atomic>
 #include <cstdint>
 #include <new>
+#include <optional>
+#include <source_location>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 //------------------------------------------------------------------------------
@@ -85,10 +121,10 @@ namespace psi::err
 /// from what has to be expected anyway precisely because of the undefined order
 /// in which parameters are constructed. If this behaviour is undesired/strictly
 /// prohibited it can be solved two ways:
-/// * on the 'library' side - Psi.Err/fallible_result can provide a
-///   'failed_result_pending()'-like function (the equivalent of
-///   std::uncaught_exception()) which a function returning a fallible_result
-///   can check and abort/return early if necessary
+/// * on the 'library' side - Psi.Err/fallible_result provides
+///   failed_result_pending() (the equivalent of std::uncaught_exceptions())
+///   which a function returning a fallible_result can check and abort/return
+///   early if necessary (see also when_all())
 /// * on the 'client' side - the user can simply first save the fallible_results
 ///   as named (T or result_or_error<T>) objects/lvalues and then call the
 ///   function/evaulate the expression with the multiple objects/arguments.
@@ -97,68 +133,199 @@ namespace psi::err
 ///
 ////////////////////////////////////////////////////////////////////////////////
 
-#ifndef NDEBUG
 namespace detail
 {
+    struct result_access;
+} // namespace detail
+
+using sanitizer_report_handler = void ( * )( char const * message, std::source_location const & construction ) noexcept;
+
+namespace detail
+{
+    inline constinit std::atomic<sanitizer_report_handler> installed_sanitizer_report_handler{ nullptr };
+} // namespace detail
+
+/// Returns the previously installed handler.
+inline sanitizer_report_handler set_sanitizer_report_handler( sanitizer_report_handler const handler ) noexcept { return detail::installed_sanitizer_report_handler.exchange( handler, std::memory_order_acq_rel ); }
+
+namespace detail
+{
+    ////////////////////////////////////////////////////////////////////////////
+    // Per-thread count of failed fallible_results that have not yet been
+    // consumed (converted to a result_or_error, branched upon, thrown or
+    // destroyed) - always enabled: only the failure path and the destructor
+    // (a test of the pending_failure state) touch it.
+    ////////////////////////////////////////////////////////////////////////////
+
+    struct pending_failures
+    {
+        static inline constinit thread_local std::uint32_t count{ 0 };
+
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        static pending_failure add() noexcept { return count++ ? pending_failure::follow_up : pending_failure::first; }
+
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        static void remove() noexcept { BOOST_ASSERT_MSG( count, "Mismatched add/remove pending failure." ); --count; }
+    }; // struct pending_failures
+} // namespace detail
+
+/// The number of failed but not yet consumed fallible_results on the calling
+/// thread (e.g. a previously evaluated argument of the function call whose
+/// argument is being computed).
+inline std::uint32_t failed_results_pending() noexcept { return detail::pending_failures::count; }
+
+/// \brief Whether a failed fallible_result is pending on the calling thread
+/// (the equivalent of std::uncaught_exceptions() != 0): lets functions
+/// (evaluated in the same full-expression) skip expensive work whose result
+/// is going to be discarded anyway:
+///     fallible_result<buffer, errno_code> read_all( file & ) { if ( failed_result_pending() ) return errno_code{ ECANCELED }; ... }
+///     consume( read_all( a ), read_all( b ) );
+inline bool failed_result_pending() noexcept { return BOOST_UNLIKELY( failed_results_pending() != 0 ); }
+
+#if PSI_ERR_SANITIZER
+namespace detail
+{
+    struct sanitizer_state
+    {
+        std::source_location location;
+        bool                 tracked   ; // the (sampled) reporting decision of its group
+        bool                 moved_from; // (void specialisation) the count was taken over by the moved-to instance
+    }; // struct sanitizer_state
+
     struct fallible_result_sanitizer
     {
-        std::uint8_t live_instance_counter  = 0;
-        bool         at_least_one_inspected = false;
+        static_assert( ( PSI_ERR_SANITIZER_SAMPLING_PERIOD & ( PSI_ERR_SANITIZER_SAMPLING_PERIOD - 1 ) ) == 0, "The sampling period has to be a power of two." );
 
-        std::uint8_t live_void_instance_counter = 0;
+        std::uint8_t  live_instance_counter  = 0;
+        bool          at_least_one_inspected = false;
+
+        std::uint8_t  live_void_instance_counter = 0;
+
+        std::uint32_t sampling_tick        = 0;
+        bool          sampled_group        = true;
+        bool          sampled_void_group   = true;
 
         static BOOST_THREAD_LOCAL_POD fallible_result_sanitizer singleton;
 
-        static void    add_instance(                      ) { singleton.   add_instance_aux(           ); }
-        static void remove_instance( bool const inspected ) { singleton.remove_instance_aux( inspected ); }
+        static sanitizer_state    add_instance     ( call_site const & site                                ) noexcept { return singleton.add_instance_aux( site ); }
+        static void               add_moved_instance( sanitizer_state const &                              ) noexcept { ++singleton.live_instance_counter; }
+        static void            remove_instance     ( sanitizer_state const & instance, bool const inspected ) noexcept { singleton.remove_instance_aux( instance, inspected ); }
+
+        static sanitizer_state    add_void_instance( call_site const & site ) noexcept
+        {
+            auto const instance( singleton.sample( site, singleton.live_void_instance_counter, singleton.sampled_void_group ) );
+            if ( singleton.live_void_instance_counter++ != 0 && instance.tracked )
+                report( "More than one fallible_result<void> instance detected", instance.location );
+            return instance;
+        }
+        static void            remove_void_instance( sanitizer_state const & instance ) noexcept
+        {
+            if ( !instance.moved_from && singleton.live_void_instance_counter-- != 1 && instance.tracked ) // the moved-to instance takes over the count (the two can get destroyed in any order)
+                report( "More than one fallible_result<void> instance detected", instance.location );
+        }
+        static sanitizer_state   move_void_instance( sanitizer_state & moved ) noexcept
+        {
+            BOOST_ASSERT( !moved.moved_from );
+            moved.moved_from = true;
+            if ( singleton.live_void_instance_counter != /*taken over from other*/1 && moved.tracked )
+                report( "More than one fallible_result<void> instance detected", moved.location );
+            return { moved.location, moved.tracked, false };
+        }
+        // the (void) instance is being consumed and a chained one may be
+        // constructed while it still exists
+        static void            release_void_instance( sanitizer_state & released ) noexcept
+        {
+            BOOST_ASSERT( !released.moved_from );
+            released.moved_from = true;
+            --singleton.live_void_instance_counter;
+        }
+
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        static void report( char const * const message, std::source_location const & location ) noexcept
+        {
+            if ( auto const handler{ installed_sanitizer_report_handler.load( std::memory_order_acquire ) } )
+                return handler( message, location );
+            std::fprintf( stderr, "%s:%u: %s: %s\n", location.file_name(), static_cast<unsigned>( location.line() ), location.function_name(), message );
+            BOOST_ASSERT_MSG( false, message );
+        }
 
     private:
-        void add_instance_aux() { ++live_instance_counter; }
+        // (the decision is made when a group of coexisting instances starts)
+        sanitizer_state sample( call_site const & site, std::uint8_t const live_counter, bool & sampled ) noexcept
+        {
+            if constexpr ( PSI_ERR_SANITIZER_SAMPLING_PERIOD != 1 )
+            {
+                if ( !live_counter )
+                    sampled = ( sampling_tick++ & ( PSI_ERR_SANITIZER_SAMPLING_PERIOD - 1 ) ) == 0;
+            }
+            return { site.location, sampled, false };
+        }
+
+        sanitizer_state add_instance_aux( call_site const & site ) noexcept
+        {
+            auto const instance( sample( site, live_instance_counter, sampled_group ) );
+            ++live_instance_counter;
+            return instance;
+        }
 
-        void remove_instance_aux( bool const inspected )
+        void remove_instance_aux( sanitizer_state const & instance, bool const inspected ) noexcept
         {
             BOOST_ASSERT_MSG( live_instance_counter > 0, "Mismatched add/remove instance." );
             at_least_one_inspected |= inspected;
             --live_instance_counter;
-            BOOST_ASSERT_MSG
+            if
             (
-                at_least_one_inspected ||
-                live_instance_counter  ||   // there are still live fallible_results (allow that one of those will be inspected even if none have been so far)
-                std::uncaught_exceptions(), // a '3rd party' exception caused early exit
-                "Uninspected fallible_result<T>."
-            );
+                instance.tracked        &&
+                !at_least_one_inspected &&
+                !live_instance_counter  &&   // there are still live fallible_results (allow that one of those will be inspected even if none have been so far)
+                !std::uncaught_exceptions()  // a '3rd party' exception caused early exit
+            )
+                report( "Uninspected fallible_result<T>.", instance.location );
             at_least_one_inspected &= ( live_instance_counter != 0 );
         }
     }; // struct fallible_result_sanitizer
 
     inline BOOST_THREAD_LOCAL_POD fallible_result_sanitizer fallible_result_sanitizer::singleton;
 } // namespace detail
-#endif // NDEBUG
+#endif // PSI_ERR_SANITIZER
 
 template <class Result, class Error>
-class [[ clang::trivial_abi ]] fallible_result
+class [[ clang::trivial_abi ]] fallible_result : public detail::combinators<fallible_result<Result, Error>>
 {
 public:
-    template <typename ... T>
-    fallible_result( T && __restrict ... argument ) noexcept( std::is_nothrow_constructible<result_or_error<Result, Error>, T &&...>::value )
+    template <typename Source>
+    constexpr fallible_result( Source && __restrict source, detail::call_site const site = {} ) noexcept( std::is_nothrow_constructible<result_or_error<Result, Error>, Source &&>::value )
+        : result_or_error_( std::forward<Source>( source ) )
+    {
+        constructed( site );
+    }
+    template <typename Source> requires detail::error_source<Source, Result, Error>
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    constexpr fallible_result( Source && __restrict error, detail::call_site const site = {} ) noexcept( std::is_nothrow_constructible<result_or_error<Result, Error>, Source &&>::value )
+        : result_or_error_( std::forward<Source>( error ), site )
+    {
+        constructed( site );
+    }
+
+    template <typename ... T> requires( sizeof...( T ) != 1 )
+    constexpr fallible_result( T && __restrict ... argument ) noexcept( std::is_nothrow_constructible<result_or_error<Result, Error>, T &&...>::value )
         : result_or_error_( std::forward<T>( argument )... )
     {
-    #ifndef NDEBUG
-        detail::fallible_result_sanitizer::add_instance();
-    #endif // NDEBUG
-        BOOST_ASSUME( !result_or_error_.inspected_ );
+        constructed( {} );
     }
 
     fallible_result( fallible_result const & ) = delete;
 
     BOOST_ATTRIBUTES( BOOST_MINSIZE ) PSI_RELEASE_FORCEINLINE
-    ~fallible_result() noexcept( false )
+    constexpr ~fallible_result() PSI_ERR_NOEXCEPT_UNLESS_EXCEPTIONS
     {
-    #ifndef NDEBUG
-        detail::fallible_result_sanitizer::remove_instance( result_or_error_.inspected_ );
-    #endif // NDEBUG
+        settle();
+    #if PSI_ERR_SANITIZER
+        if ( !std::is_constant_evaluated() )
+            detail::fallible_result_sanitizer::remove_instance( sanitizer_, result_or_error_.inspected_ );
+    #endif // PSI_ERR_SANITIZER
         result_or_error_.throw_if_uninspected_error();
-        BOOST_ASSUME( result_or_error_.inspected_ );
+        BOOST_ASSUME( result_or_error_.inspected() );
     }
 
     // Due to rules regarding NRVO, over which a programmer has no control,
@@ -172,40 +339,86 @@ public:
     // that sort of usage, is to return calling propagate (which inhibts NRVO)
     // (e.g. return my_result.propagate();).
     // https://en.cppreference.com/w/cpp/language/copy_elision
-    fallible_result propagate() noexcept( std::is_nothrow_move_constructible_v<Result> ) { return std::move( *this ); }
+    constexpr fallible_result propagate() noexcept( detail::is_nothrow_move_constructible_v<Result> ) { return std::move( *this ); }
 
-    result_or_error<Result, Error> as_result_or_error() && noexcept { BOOST_ASSUME( !result_or_error_.inspected_ ); std::move( *this ).ignore_failure(); return std::move( result_or_error_ ); }
-    result_or_error<Result, Error> operator()        () && noexcept { return std::move( *this ).as_result_or_error(); }
+    constexpr result_or_error<Result, Error> as_result_or_error() && noexcept { BOOST_ASSUME( detail::unchecked_inspection() || !result_or_error_.inspected_ ); settle(); detail::inspect_on_exit const inspected{ result_or_error_.inspected_ }; return std::move( result_or_error_ ); }
+    constexpr result_or_error<Result, Error> operator()        () && noexcept { return std::move( *this ).as_result_or_error(); }
 
-    operator result_or_error<Result, Error> &&() && noexcept { return std::move( *this ).as_result_or_error(); }
-    operator Result                         &&() &&          { return std::move( result() ); }
+    constexpr operator result_or_error<Result, Error> &&() && noexcept { return std::move( *this ).as_result_or_error(); }
+    constexpr operator Result                         &&() &&          { return std::move( result() ); }
+#if __cpp_lib_expected
+    /// \note Converts in place (a single move of the Result or Error) but only
+    /// with copy-initialisation (e.g. std::expected<...> e = f(); or return
+    /// f();): direct-initialisation picks the std::expected constructor from
+    /// the Result instead (i.e. goes through the throwing operator Result &&).
+    constexpr operator std::expected<Result, Error>() && noexcept( detail::is_nothrow_move_constructible_v<std::expected<Result, Error>> ) { settle(); return std::move( result_or_error_ ).operator std::expected<Result, Error>(); }
+#endif // __cpp_lib_expected
 
-                                                         Result && operator *  () && { return  result(); }
-    BOOST_ATTRIBUTES( BOOST_RESTRICTED_FUNCTION_RETURN ) Result *  operator -> () && { return &result(); }
+                                                         constexpr Result && operator *  () && { return  result(); }
+    BOOST_ATTRIBUTES( BOOST_RESTRICTED_FUNCTION_RETURN ) constexpr Result *  operator -> () && { return &result(); }
 
-    explicit operator bool() && noexcept { return static_cast<bool>( result_or_error_ ); }
+    constexpr explicit operator bool() && noexcept { settle(); return static_cast<bool>( result_or_error_ ); }
 
-    void ignore_failure() BOOST_RESTRICTED_THIS && noexcept { result_or_error_.inspected_ = true; }
+    constexpr void ignore_failure() BOOST_RESTRICTED_THIS && noexcept { settle(); result_or_error_.inspected_ = true; }
 
 private:
-    fallible_result( fallible_result && __restrict other ) noexcept( std::is_nothrow_move_constructible<result_or_error<Result, Error>>::value )
-        : result_or_error_( std::move( std::move( other ).as_result_or_error() ) )
+    constexpr fallible_result( fallible_result && __restrict other ) noexcept( std::is_nothrow_move_constructible<result_or_error<Result, Error>>::value )
+        : result_or_error_( std::move( std::move( other ).as_result_or_error_pending() ) )
+    #if PSI_ERR_SANITIZER
+        , sanitizer_( other.sanitizer_ )
+    #endif // PSI_ERR_SANITIZER
     {
-#   ifndef NDEBUG
-        detail::fallible_result_sanitizer::add_instance();
-#   endif // NDEBUG
-        BOOST_ASSUME( other.result_or_error_.inspected_ == true  );
-        BOOST_ASSUME( this->result_or_error_.inspected_ == false );
+    #if PSI_ERR_SANITIZER
+        if ( !std::is_constant_evaluated() )
+            detail::fallible_result_sanitizer::add_moved_instance( sanitizer_ );
+    #endif // PSI_ERR_SANITIZER
+        pending() = std::exchange( other.pending(), detail::pending_failure::none );
+        BOOST_ASSUME( other.result_or_error_.inspected() );
+        BOOST_ASSUME( detail::unchecked_inspection() || !this->result_or_error_.inspected_ );
     }
 
-    Result && result()
+    constexpr void constructed( [[ maybe_unused ]] detail::call_site const & site ) noexcept
     {
+    #if PSI_ERR_SANITIZER
+        // (there is no sanitizer state in constant evaluation)
+        sanitizer_ = std::is_constant_evaluated() ? detail::sanitizer_state{} : detail::fallible_result_sanitizer::add_instance( site );
+    #endif // PSI_ERR_SANITIZER
+        if ( !result_or_error_.succeeded() && !std::is_constant_evaluated() )
+            pending() = detail::pending_failures::add();
+        // a (trivially) moved-in result_or_error carries over its inspected_ flag
+        result_or_error_.inspected_ = false;
+        BOOST_ASSUME( detail::unchecked_inspection() || !result_or_error_.inspected_ );
+    }
+
+    constexpr Result && result()
+    {
+    #ifdef BOOST_NO_EXCEPTIONS
+        // the failure handler does not unwind (e.g. it longjmp()s) i.e. the
+        // destructor might not get to settle
+        if ( BOOST_UNLIKELY( !result_or_error_.succeeded() ) )
+            settle();
+    #endif // BOOST_NO_EXCEPTIONS
         result_or_error_.throw_if_error();
-        BOOST_ASSUME( result_or_error_.inspected_ );
+        BOOST_ASSUME( result_or_error_.inspected() );
+        BOOST_ASSUME( pending() == detail::pending_failure::none ); // (only failures are pending)
       //BOOST_ASSUME( result_or_error_.succeeded_ ); // the 'compressed' specialisation does not have the 'succeeded_' member
         return static_cast<Result &&>( result_or_error_.result_ );
     }
 
+    // (a consumed failure is no longer pending - moves take the state over)
+    constexpr void settle() noexcept
+    {
+        if ( BOOST_UNLIKELY( pending() != detail::pending_failure::none ) )
+        {
+            pending() = detail::pending_failure::none;
+            detail::pending_failures::remove();
+        }
+    }
+
+    constexpr detail::pending_failure & pending() noexcept { return result_or_error_.pending_; }
+
+    constexpr result_or_error<Result, Error> as_result_or_error_pending() && noexcept { detail::inspect_on_exit const inspected{ result_or_error_.inspected_ }; return std::move( result_or_error_ ); }
+
 private: // prevent bogus heap creation
     void * operator new     (         std::size_t                         ) = delete;
     void * operator new[]   (         std::size_t                         ) = delete;
@@ -216,11 +429,14 @@ private: // prevent bogus heap creation
     void   operator delete  ( void *, std::size_t                         ) = delete;
     void   operator delete[]( void *, std::size_t                         ) = delete;
 
-private: friend class result_or_error<Result, Error>;
+private: friend class result_or_error<Result, Error>; friend struct detail::result_access;
     /// \note (Private) inheritance cannot be used as that would break the
     /// result_or_error implicit conversion operator.
     ///                                       (22.05.2015.) (Domagoj Saric)
-    result_or_error<Result, Error> result_or_error_;
+    [[ no_unique_address ]] result_or_error<Result, Error> result_or_error_;
+#if PSI_ERR_SANITIZER
+    detail::sanitizer_state sanitizer_;
+#endif // PSI_ERR_SANITIZER
 }; // class fallible_result
 
 
@@ -234,65 +450,97 @@ template <class Error> using possible      = fallible_result<void, Error>;
 template <class Error> using fallible_with = fallible_result<void, Error>;
 
 template <class Error>
-class [[ clang::trivial_abi ]] fallible_result<void, Error> //...mrmlj...kill the duplication...
+class [[ clang::trivial_abi ]] fallible_result<void, Error> : public detail::combinators<fallible_result<void, Error>> //...mrmlj...kill the duplication...
 {
 public:
     using result = result_or_error<void, Error>;
 
 public:
-    template <typename ... T>
-    fallible_result( T && __restrict ... argument ) noexcept( std::is_nothrow_constructible<result, T && ...>::value )
+    template <typename Source>
+    constexpr fallible_result( Source && __restrict source, detail::call_site const site = {} ) noexcept( detail::is_nothrow_constructible_v<result, Source &&> )
+        : void_or_error_( std::forward<Source>( source ) )
+    {
+        constructed( site );
+    }
+    template <typename Source> requires detail::error_source<Source, void, Error>
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    constexpr fallible_result( Source && __restrict error, detail::call_site const site = {} ) noexcept( detail::is_nothrow_constructible_v<result, Source &&> )
+        : void_or_error_( std::forward<Source>( error ), site )
+    {
+        constructed( site );
+    }
+
+    template <typename ... T> requires( sizeof...( T ) != 1 )
+    constexpr fallible_result( T && __restrict ... argument ) noexcept( detail::is_nothrow_constructible_v<result, T && ...> )
         : void_or_error_( std::forward<T>( argument )... )
     {
-        BOOST_ASSERT_MSG
-        (
-            detail::fallible_result_sanitizer::singleton.live_void_instance_counter++ == 0,
-            "More than one fallible_result<void> instance detected"
-        );
-        BOOST_ASSUME( !void_or_error_.inspected_ );
+        constructed( {} );
     }
 
     BOOST_OPTIMIZE_FOR_SIZE_BEGIN() PSI_RELEASE_FORCEINLINE
-    ~fallible_result() noexcept( false )
+    constexpr ~fallible_result() PSI_ERR_NOEXCEPT_UNLESS_EXCEPTIONS
     {
-        BOOST_ASSERT_MSG
-        (
-            detail::fallible_result_sanitizer::singleton.live_void_instance_counter-- == 1 + moved_from_,
-            "More than one fallible_result<void> instance detected"
-        );
+        settle();
+    #if PSI_ERR_SANITIZER
+        if ( !std::is_constant_evaluated() )
+            detail::fallible_result_sanitizer::remove_void_instance( sanitizer_ );
+    #endif // PSI_ERR_SANITIZER
         void_or_error_.throw_if_uninspected_error();
-        BOOST_ASSUME( void_or_error_.inspected_ );
+        BOOST_ASSUME( void_or_error_.inspected() );
     }
     BOOST_OPTIMIZE_FOR_SIZE_END()
 
     // see the note in the main template
-    fallible_result propagate() noexcept( std::is_nothrow_move_constructible_v<result> ) { return std::move( *this ); }
+    constexpr fallible_result propagate() noexcept( detail::is_nothrow_move_constructible_v<result> ) { return std::move( *this ); }
 
-    result operator()() && noexcept { return std::move( *this ); }
-    operator result  () && noexcept { return std::move( void_or_error_ ); }
+    constexpr result operator()() && noexcept { return std::move( *this ); }
+    constexpr operator result  () && noexcept { settle(); detail::inspect_on_exit const inspected{ void_or_error_.inspected_ }; return std::move( void_or_error_ ); }
+#if __cpp_lib_expected
+    constexpr operator std::expected<void, Error>() && noexcept( detail::is_nothrow_move_constructible_v<Error> ) { settle(); return std::move( void_or_error_ ).operator std::expected<void, Error>(); }
+#endif // __cpp_lib_expected
 
-    bool succeeded() && noexcept { return void_or_error_.succeeded(); }
+    constexpr bool succeeded() && noexcept { settle(); return void_or_error_.succeeded(); }
 
-    explicit operator bool() && noexcept { return std::move( *this ).succeeded(); }
+    constexpr explicit operator bool() && noexcept { return std::move( *this ).succeeded(); }
 
-    void ignore_failure() && noexcept { std::move( *this ).succeeded(); }
+    constexpr void ignore_failure() && noexcept { std::move( *this ).succeeded(); }
 
 private: // see not for propagate()
-    fallible_result( fallible_result && __restrict other ) noexcept( std::is_nothrow_move_constructible_v<result> )
-        : void_or_error_( std::move( other ).operator result &&() )
+    constexpr fallible_result( fallible_result && __restrict other ) noexcept( detail::is_nothrow_move_constructible_v<result> )
+        : void_or_error_( std::move( other ).as_result_pending() )
+    #if PSI_ERR_SANITIZER
+        , sanitizer_( std::is_constant_evaluated() ? other.sanitizer_ : detail::fallible_result_sanitizer::move_void_instance( other.sanitizer_ ) )
+    #endif // PSI_ERR_SANITIZER
+    {
+        pending() = std::exchange( other.pending(), detail::pending_failure::none );
+        BOOST_ASSUME( detail::unchecked_inspection() || !void_or_error_.inspected_ );
+    }
+
+    constexpr void constructed( [[ maybe_unused ]] detail::call_site const & site ) noexcept
+    {
+        if ( !void_or_error_.succeeded() && !std::is_constant_evaluated() )
+            pending() = detail::pending_failures::add();
+        void_or_error_.inspected_ = false; // see the note in the main template
+    #if PSI_ERR_SANITIZER
+        sanitizer_ = std::is_constant_evaluated() ? detail::sanitizer_state{} : detail::fallible_result_sanitizer::add_void_instance( site );
+    #endif // PSI_ERR_SANITIZER
+        BOOST_ASSUME( detail::unchecked_inspection() || !void_or_error_.inspected_ );
+    }
+
+    // see the main template
+    constexpr void settle() noexcept
     {
-#   ifndef NDEBUG
-        BOOST_ASSERT( !other.moved_from_ );
-        other.moved_from_ = true;
-        BOOST_ASSERT_MSG
-        (
-            detail::fallible_result_sanitizer::singleton.live_void_instance_counter++ == /*other destructor yet has to be called*/1,
-            "More than one fallible_result<void> instance detected"
-        );
-#   endif
-        BOOST_ASSUME( !void_or_error_.inspected_ );
+        if ( BOOST_UNLIKELY( pending() != detail::pending_failure::none ) )
+        {
+            pending() = detail::pending_failure::none;
+            detail::pending_failures::remove();
+        }
     }
 
+    constexpr detail::pending_failure & pending() noexcept { return void_or_error_.pending_; }
+
+    constexpr result as_result_pending() && noexcept { detail::inspect_on_exit const inspected{ void_or_error_.inspected_ }; return std::move( void_or_error_ ); }
+
 private: // prevent bogus heap creation
     void * operator new     (         std::size_t                         ) = delete;
     void * operator new[]   (         std::size_t                         ) = delete;
@@ -303,23 +551,185 @@ private: // prevent bogus heap creation
     void   operator delete  ( void *, std::size_t                         ) = delete;
     void   operator delete[]( void *, std::size_t                         ) = delete;
 
-private: friend result;
-    result void_or_error_;
-#ifndef NDEBUG
-    bool moved_from_{ false };
-#endif
+private: friend result; friend struct detail::result_access;
+    [[ no_unique_address ]] result void_or_error_;
+#if PSI_ERR_SANITIZER
+    detail::sanitizer_state sanitizer_;
+#endif // PSI_ERR_SANITIZER
 }; // class fallible_result<void, Error>
 
 
-template <typename Result, typename Error> bool operator==( fallible_result<Result, Error> && result, no_err_t ) noexcept { return  std::move( result ).succeeded(); }
-template <typename Result, typename Error> bool operator==( fallible_result<Result, Error> && result, an_err_t ) noexcept { return !std::move( result ).succeeded(); }
-template <typename Result, typename Error> bool operator!=( fallible_result<Result, Error> && result, no_err_t ) noexcept { return !std::move( result ).succeeded(); }
-template <typename Result, typename Error> bool operator!=( fallible_result<Result, Error> && result, an_err_t ) noexcept { return  std::move( result ).succeeded(); }
+namespace detail
+{
+    struct result_access
+    {
+        template <class Result, class Error> static constexpr result_or_error<Result, Error> & inner( fallible_result<Result, Error> & fallible ) noexcept { return fallible.result_or_error_; }
+        template <             class Error> static constexpr void_or_error  <        Error> & inner( fallible_result<void  , Error> & fallible ) noexcept { return fallible.void_or_error_  ; }
+
+        // consuming access (settles the pending failure and the void
+        // specialisation hands over its 'live instance' count so that a
+        // chained fallible_result<void> can be constructed while the source
+        // still exists)
+        template <class Result, class Error> static constexpr result_or_error<Result, Error> & release( fallible_result<Result, Error> & fallible ) noexcept { fallible.settle(); return inner( fallible ); }
+        template <             class Error> static constexpr void_or_error  <        Error> & release( fallible_result<void  , Error> & fallible ) noexcept
+        {
+            fallible.settle();
+        #if PSI_ERR_SANITIZER
+            if ( !std::is_constant_evaluated() )
+                fallible_result_sanitizer::release_void_instance( fallible.sanitizer_ );
+        #endif // PSI_ERR_SANITIZER
+            return inner( fallible );
+        }
+
+        template <class Result, class Error> static constexpr pending_failure pending( fallible_result<Result, Error> & fallible ) noexcept { return fallible.pending(); }
+    }; // struct result_access
+
+    template <class Result, class Error>
+    struct result_traits<fallible_result<Result, Error>>
+    {
+        using result = Result;
+        using error  = Error ;
+
+        template <class Chained>
+        using rebind = fallible_result<typename result_traits<Chained>::result, typename result_traits<Chained>::error>;
+
+        static constexpr result_or_error<Result, Error> & source( fallible_result<Result, Error> & self ) noexcept { return result_access::release( self ); }
+    }; // struct result_traits<fallible_result>
+
+    // (a propagated failure is consumed, i.e. no longer pending, when the
+    // returned one gets created)
+    template <class Result, class Error>
+    constexpr result_or_error<Result, Error> & try_target( fallible_result<Result, Error> & result ) noexcept { return result_access::release( result ); }
+} // namespace detail
+
+
+template <typename Result, typename Error> constexpr bool operator==( fallible_result<Result, Error> && result, no_err_t ) noexcept { return  std::move( result ).succeeded(); }
+template <typename Result, typename Error> constexpr bool operator==( fallible_result<Result, Error> && result, an_err_t ) noexcept { return !std::move( result ).succeeded(); }
+template <typename Result, typename Error> constexpr bool operator!=( fallible_result<Result, Error> && result, no_err_t ) noexcept { return !std::move( result ).succeeded(); }
+template <typename Result, typename Error> constexpr bool operator!=( fallible_result<Result, Error> && result, an_err_t ) noexcept { return  std::move( result ).succeeded(); }
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \brief Combines fallible_results (e.g. of the calls making up the
+/// arguments of a function call) into a single
+/// fallible_result<std::tuple<Results...>, Error>.
+///
+/// \detail All the arguments are inspected (i.e. none of the others throws
+/// when one has failed). The returned Error is that of the first (in argument
+/// order) failure that was not created while another failure was already
+/// pending, i.e. a genuine failure is preferred over the early returns (the
+/// follow-up failures) of the functions that checked failed_result_pending()
+/// (which can happen as the order of evaluation of the arguments is
+/// unspecified):
+///     std::tuple<header, body> const message = when_all( read_header( file ), read_body( file ) );
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Error, class ... Results>
+fallible_result<std::tuple<Results...>, Error> when_all( fallible_result<Results, Error> && ... results )
+{
+    static_assert( sizeof...( Results ) > 0 );
+    static_assert( ( !std::is_void_v<Results> && ... ), "fallible_result<void> instances cannot coexist (see the sanitizer) - use result_or_error<void> instead." );
+    using target = fallible_result<std::tuple<Results...>, Error>;
+    using detail::result_access;
+
+    auto const failure_rank
+    {
+        []( auto & fallible ) noexcept -> unsigned
+        {
+            if ( result_access::inner( fallible ).succeeded() ) [[ likely ]]
+                return 0;
+            return result_access::pending( fallible ) == detail::pending_failure::follow_up ? 1 : 2;
+        }
+    };
+    unsigned const ranks[]{ failure_rank( results )... };
+    unsigned       failed{ 0 }; // index + 1 of the chosen failure
+    for ( unsigned index{ 0 }, best{ 0 }; index != sizeof...( Results ); ++index )
+        if ( ranks[ index ] > best ) { best = ranks[ index ]; failed = index + 1; }
+
+    if ( BOOST_LIKELY( !failed ) )
+        return detail::make_succeeded<target>( std::move( result_access::release( results ) ).assume_succeeded()... );
+
+    std::optional<Error> error;
+    unsigned index{ 0 };
+    (
+        [ & ]( auto & fallible )
+        {
+            auto & source( result_access::release( fallible ) );
+            if ( ++index == failed )
+                error.emplace( std::move( source ).error() );
+        }( results ),
+        ...
+    );
+    return detail::make_failed<target>( std::move( *error ) );
+}
 
 
 template <typename T>
 using infallible_result = T;
 
+
+namespace detail::constexpr_check
+{
+    // Compile-time checks of every result_or_error specialisation and of
+    // fallible_result: constant evaluation (with the compiler at hand - see
+    // unchecked_inspection()) and layout.
+    struct error       { int value; };
+    struct empty_error {};
+    struct handle      { int fd; friend constexpr bool operator==( handle, handle ) noexcept = default; };
+    struct boolish     { int value{ 0 }; constexpr operator bool() const noexcept { return value != 0; } friend constexpr bool operator==( boolish, boolish ) noexcept = default; };
+    struct code
+    {
+        using value_type = signed char;
+        static value_type constexpr no_error = 0;
+        constexpr code( value_type const value ) noexcept : value_( value ) {}
+        constexpr explicit operator value_type() const noexcept { return value_; }
+        value_type value_;
+    }; // struct code
+} // namespace detail::constexpr_check
+
+template <> struct niche_traits   <detail::constexpr_check::handle> { static constexpr detail::constexpr_check::handle invalid() noexcept { return { -1 }; } };
+template <> struct sentinel_traits<detail::constexpr_check::code  > { static detail::constexpr_check::code::value_type constexpr unknown_error = -1; };
+
+namespace detail::constexpr_check
+{
+    template <class Result, class Error>
+    constexpr bool check( Result const value, Error const failure ) noexcept
+    {
+        using target   = result_or_error<Result, Error>;
+        using fallible = fallible_result<Result, Error>;
+        auto succeeded{ make_succeeded<target>( Result( value ) ) };
+        auto failed   { make_failed   <target>( Error ( failure ) ) };
+        auto moved    { succeeded.propagate() };
+        Result const converted = make_succeeded<fallible>( Result( value ) );
+        return
+            moved && ( *moved == value ) && !failed && ( converted == value ) &&
+            !make_failed<fallible>( Error( failure ) ) &&
+            ( std::move( moved ).transform( []( Result && result ) { return result; } ).value_or( Result( value ) ) == value );
+    }
+
+    constexpr bool check_void() noexcept
+    {
+        using target = result_or_error<void, error>;
+        return make_succeeded<target>() && !make_failed<target>( error{ 3 } ) && !make_failed<fallible_result<void, error>>( error{ 3 } );
+    }
+
+    static_assert( !compressed_result_error_variant<int, error> && !niche_result_error_variant<int, error> && !sentinel_result_error_variant<int, error> );
+    static_assert( compressed_result_error_variant< boolish, empty_error> && check( boolish{ 2 }, empty_error{} ) );
+    static_assert( niche_result_error_variant     < handle , empty_error> && check( handle { 4 }, empty_error{} ) );
+    static_assert( sentinel_result_error_variant  < int    , code       > && check( 9           , code{ 2 }     ) );
+    static_assert( check( 5, error{ 3 } ) );
+    static_assert( check_void() );
+
+#if !PSI_ERR_SANITIZER
+    // the pending_failure state lives in the padding of the result_or_error
+    // (e.g. a fallible_result<int, last_errno> is two ints)
+    static_assert( sizeof( fallible_result<int , error> ) == sizeof( result_or_error<int, error> ) && sizeof( result_or_error<int, error> ) == 2 * sizeof( int ) );
+    static_assert( sizeof( fallible_result<void, error> ) == sizeof( result_or_error<void, error> ) );
+#endif // PSI_ERR_SANITIZER
+} // namespace detail::constexpr_check
+
 //------------------------------------------------------------------------------
 } // namespace psi::err
 //------------------------------------------------------------------------------
@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file hresult.hpp
+/// -----------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "win32.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#include <cstdint>
+#include <exception>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class hresult_error
+///
+/// \brief An HRESULT returned by an API (COM, DirectStorage, DXGI...).
+///
+/// \detail Constructed from the returned value (i.e. no GetLastError() TEB
+/// access). Only S_OK is the no_error value (in all result_or_error layouts):
+/// from_hresult() applies the SUCCEEDED() test (i.e. S_FALSE & co. are also
+/// successes). Opts into the sentinel_result_error_variant layout
+/// (e.g. result_or_error<std::uint64_t, hresult_error> needs no separate
+/// discriminator).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+struct hresult_error
+{
+    using value_type = HRESULT;
+
+    static value_type const no_error = S_OK;
+
+    constexpr explicit hresult_error( value_type const code ) noexcept : value( code ) {}
+
+    /// \note See last_win32_error::operator value_type.
+    explicit constexpr
+    operator value_type() const noexcept { return value; }
+
+    value_type value;
+}; // struct hresult_error
+
+template <> struct sentinel_traits<hresult_error> { static hresult_error::value_type constexpr unknown_error = E_FAIL; };
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class hresult_exception
+///
+/// \brief The exception thrown for hresult_error errors.
+///
+/// \detail Shares the (FORMAT_MESSAGE_FROM_SYSTEM) cache with win32_error (the
+/// two code ranges do not overlap) - see win32_error.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+class hresult_exception : public std::exception
+{
+public:
+    using value_type = hresult_error::value_type;
+
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    explicit hresult_exception( value_type const code ) noexcept : code_( code ), message_( detail::system_messages.get( static_cast<std::uint32_t>( code ) ) ) {}
+
+    value_type code() const noexcept { return code_; }
+
+    char const * what() const noexcept override { return message_; }
+
+private:
+    value_type   code_   ;
+    char const * message_;
+}; // class hresult_exception
+
+
+inline BOOST_ATTRIBUTES( BOOST_COLD )
+hresult_exception make_exception( hresult_error const error ) noexcept
+{
+    BOOST_ASSERT_MSG( error.value != hresult_error::no_error, "Throwing on no error?" );
+    return hresult_exception( error.value );
+}
+
+
+/// HRESULT returning APIs: SUCCEEDED() codes (i.e. also S_FALSE & co.) are
+/// successes (the particular success code is dropped).
+inline
+void_or_error<hresult_error> from_hresult( hresult_error::value_type const hr ) noexcept
+{
+    if ( SUCCEEDED( hr ) ) [[ likely ]]
+        return no_err;
+    return void_or_error<hresult_error>( std::in_place_type<hresult_error>, hr );
+}
+
+BOOST_OPTIMIZE_FOR_SIZE_END()
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file ntstatus.hpp
+/// ------------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "win32.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#include <cstdint>
+#include <exception>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class ntstatus_error
+///
+/// \brief An NTSTATUS returned by a native (Nt*/Rtl*) API.
+///
+/// \detail Constructed from the returned value (i.e. no GetLastError() TEB
+/// access). Only STATUS_SUCCESS is the no_error value (in all
+/// result_or_error layouts): from_ntstatus() applies the NT_SUCCESS() test
+/// (i.e. informational statuses are also successes). Opts into the
+/// sentinel_result_error_variant layout.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+struct ntstatus_error
+{
+    using value_type = LONG; // NTSTATUS (not declared by windows.h)
+
+    static value_type const no_error = 0; // STATUS_SUCCESS
+
+    constexpr explicit ntstatus_error( value_type const code ) noexcept : value( code ) {}
+
+    /// \note See last_win32_error::operator value_type.
+    explicit constexpr
+    operator value_type() const noexcept { return value; }
+
+    value_type value;
+}; // struct ntstatus_error
+
+template <> struct sentinel_traits<ntstatus_error> { static ntstatus_error::value_type constexpr unknown_error = static_cast<LONG>( 0xC0000001 ); }; // STATUS_UNSUCCESSFUL
+
+
+namespace detail
+{
+    // NTSTATUS messages live in ntdll's message table
+    inline BOOST_ATTRIBUTES( BOOST_COLD )
+    char * format_ntstatus_message( std::uint32_t const code ) noexcept
+    {
+        auto const ntdll( ::GetModuleHandleW( L"ntdll.dll" ) );
+        return ntdll ? format_system_message( code, ntdll ) : nullptr;
+    }
+
+    inline constinit message_cache<&format_ntstatus_message> ntstatus_messages;
+} // namespace detail
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class ntstatus_exception
+///
+/// \brief The exception thrown for ntstatus_error errors (see win32_error).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+class ntstatus_exception : public std::exception
+{
+public:
+    using value_type = ntstatus_error::value_type;
+
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    explicit ntstatus_exception( value_type const code ) noexcept : code_( code ), message_( detail::ntstatus_messages.get( static_cast<std::uint32_t>( code ) ) ) {}
+
+    value_type code() const noexcept { return code_; }
+
+    char const * what() const noexcept override { return message_; }
+
+private:
+    value_type   code_   ;
+    char const * message_;
+}; // class ntstatus_exception
+
+
+inline BOOST_ATTRIBUTES( BOOST_COLD )
+ntstatus_exception make_exception( ntstatus_error const error ) noexcept
+{
+    BOOST_ASSERT_MSG( error.value != ntstatus_error::no_error, "Throwing on no error?" );
+    return ntstatus_exception( error.value );
+}
+
+
+/// NTSTATUS returning APIs: NT_SUCCESS() statuses (i.e. also the
+/// informational ones) are successes (the particular status is dropped).
+inline
+void_or_error<ntstatus_error> from_ntstatus( ntstatus_error::value_type const status ) noexcept
+{
+    if ( status >= 0 ) [[ likely ]] // NT_SUCCESS()
+        return no_err;
+    return void_or_error<ntstatus_error>( std::in_place_type<ntstatus_error>, status );
+}
+
+BOOST_OPTIMIZE_FOR_SIZE_END()
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
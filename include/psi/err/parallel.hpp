@@ -0,0 +1,319 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file parallel.hpp
+/// ------------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "fallible_result.hpp"
+#include "result_or_error.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Parallel algorithms over fallible operations
+/// --------------------------------------------
+///
+/// \brief parallel_transform and parallel_reduce run a callable returning a
+/// result_or_error<T, E> or fallible_result<T, E> over a random access range
+/// on a number of threads (the caller being one of them) and stop all of them
+/// early on the first failure.
+///
+/// \detail Elements are handed out in chunks (of parallel_options::grain
+/// elements) through a shared atomic cursor. The first failure (in time, not
+/// necessarily the lowest index) is published through an atomic flag which
+/// the workers check (a relaxed load) before every element, i.e. a failed job
+/// takes 'time to first error' rather than a full scan. The Error of the
+/// first failure is returned, the others are discarded. An exception escaping
+/// the callable is treated the same way and rethrown in the calling thread.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+struct parallel_options
+{
+    unsigned    threads{ 0 }; ///< 0 - std::thread::hardware_concurrency()
+    std::size_t grain  { 0 }; ///< elements per chunk (0 - automatic)
+}; // struct parallel_options
+
+namespace detail
+{
+    template <class Error>
+    class first_failure
+    {
+    public:
+         first_failure() noexcept {}
+        ~first_failure() noexcept( std::is_nothrow_destructible_v<Error> ) { if ( stored_ == stored::error ) std::destroy_at( &error_ ); }
+
+        bool failed() const noexcept { return BOOST_UNLIKELY( failed_.load( std::memory_order_relaxed ) ); }
+
+        // (the winner is the only writer and the joins of the workers make the
+        // stored Error visible to the caller)
+        template <typename Source>
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        void publish( Source && error ) noexcept( std::is_nothrow_constructible_v<Error, Source &&> )
+        {
+            if ( failed_.exchange( true, std::memory_order_relaxed ) )
+                return;
+            std::construct_at( &error_, std::forward<Source>( error ) );
+            stored_ = stored::error;
+        }
+
+    #ifndef BOOST_NO_EXCEPTIONS
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        void publish_exception( std::exception_ptr exception ) noexcept
+        {
+            if ( failed_.exchange( true, std::memory_order_relaxed ) )
+                return;
+            exception_ = std::move( exception );
+            stored_    = stored::exception;
+        }
+
+        void rethrow_if_exception() const { if ( BOOST_UNLIKELY( stored_ == stored::exception ) ) std::rethrow_exception( exception_ ); }
+    #else
+        void rethrow_if_exception() const noexcept {}
+    #endif // BOOST_NO_EXCEPTIONS
+
+        Error && error() && noexcept { BOOST_ASSERT( stored_ == stored::error ); return std::move( error_ ); }
+
+    private:
+        enum struct stored : std::uint8_t { nothing, error, exception };
+
+        std::atomic<bool> failed_{ false };
+        stored            stored_{ stored::nothing };
+        union { Error error_; };
+    #ifndef BOOST_NO_EXCEPTIONS
+        std::exception_ptr exception_;
+    #endif // BOOST_NO_EXCEPTIONS
+    }; // class first_failure
+
+    struct parallel_plan
+    {
+        parallel_plan( std::size_t const elements, parallel_options const options ) noexcept
+            : count( elements )
+        {
+            auto const hardware( std::max( std::thread::hardware_concurrency(), 1U ) );
+            auto const threads ( options.threads ? options.threads : hardware );
+            grain   = options.grain ? options.grain : std::max<std::size_t>( 1, count / ( std::size_t{ threads } * 8 ) );
+            workers = static_cast<unsigned>( std::clamp<std::size_t>( ( count + grain - 1 ) / grain, 1, threads ) );
+        }
+
+        std::size_t count;
+        std::size_t grain;
+        unsigned    workers;
+    }; // struct parallel_plan
+
+    /// Runs element( worker, index ) -> bool (false - failed, stop) over
+    /// [0, plan.count) on plan.workers threads (including the caller).
+    template <class Error, typename Element>
+    void run_parallel( parallel_plan const & plan, first_failure<Error> & failure, Element & element )
+    {
+        std::atomic<std::size_t> cursor{ 0 };
+        auto const work
+        {
+            [ &, grain = plan.grain, count = plan.count ]( unsigned const worker ) noexcept
+            {
+                auto const chunks
+                {
+                    [ & ]
+                    {
+                        while ( !failure.failed() )
+                        {
+                            auto const begin( cursor.fetch_add( grain, std::memory_order_relaxed ) );
+                            if ( begin >= count )
+                                return;
+                            auto const end( std::min( begin + grain, count ) );
+                            for ( auto index{ begin }; index != end; ++index )
+                                if ( !element( worker, index ) || failure.failed() )
+                                    return;
+                        }
+                    }
+                };
+            #ifndef BOOST_NO_EXCEPTIONS
+                try { chunks(); } catch ( ... ) { failure.publish_exception( std::current_exception() ); }
+            #else
+                chunks();
+            #endif // BOOST_NO_EXCEPTIONS
+            }
+        };
+
+        std::vector<std::thread> helpers;
+        helpers.reserve( plan.workers - 1 );
+        for ( unsigned worker{ 1 }; worker < plan.workers; ++worker )
+        {
+        #ifndef BOOST_NO_EXCEPTIONS
+            try { helpers.emplace_back( work, worker ); }
+            catch ( std::system_error const & ) { break; } // make do with the threads we got
+        #else
+            helpers.emplace_back( work, worker );
+        #endif // BOOST_NO_EXCEPTIONS
+        }
+        work( 0 );
+        for ( auto & helper : helpers )
+            helper.join();
+    }
+
+    template <class F, class Argument>
+    using parallel_outcome = std::remove_cvref_t<std::invoke_result_t<F &, Argument>>;
+
+    // Inspects (exactly once) an outcome and either hands over the Result or
+    // publishes the Error
+    template <class Outcome, class Error, typename Consume>
+    bool settle( Outcome & outcome, first_failure<Error> & failure, Consume && consume )
+    {
+        auto & source( result_traits<Outcome>::source( outcome ) );
+        if ( source.succeeded() ) [[ likely ]]
+        {
+            if constexpr ( std::is_void_v<typename result_traits<Outcome>::result> ) { std::move( source ).assume_succeeded(); consume(); }
+            else                                                                       consume( std::move( source ).assume_succeeded() );
+            return true;
+        }
+        failure.publish( std::move( source ).error() );
+        return false;
+    }
+} // namespace detail
+
+
+/// f( *iterator ) -> result_or_error<T, E> or fallible_result<T, E>
+/// Returns result_or_error<std::vector<T>, E> (result_or_error<void, E> for
+/// void Ts) - the Results are in input order.
+template <std::random_access_iterator Iterator, typename F>
+auto parallel_transform( Iterator const first, Iterator const last, F && f, parallel_options const options = {} )
+{
+    using outcome = detail::parallel_outcome<F, std::iter_reference_t<Iterator>>;
+    using result  = typename detail::result_traits<outcome>::result;
+    using error   = typename detail::result_traits<outcome>::error ;
+    static_assert( !std::is_same_v<result, bool>, "std::vector<bool> elements cannot be written concurrently." );
+
+    constexpr bool void_result{ std::is_void_v<result> };
+    using results_t = std::conditional_t<void_result, void, std::vector<std::conditional_t<void_result, int, result>>>;
+    using target    = result_or_error<results_t, error>;
+
+    detail::parallel_plan const plan( static_cast<std::size_t>( last - first ), options );
+    detail::first_failure<error> failure;
+
+    std::conditional_t<void_result, no_err_t, results_t> results;
+    if constexpr ( !void_result )
+    {
+        static_assert( std::is_default_constructible_v<result>, "parallel_transform requires default constructible Results." );
+        results.resize( plan.count );
+    }
+
+    auto element
+    {
+        [ & ]( unsigned, std::size_t const index )
+        {
+            auto outcome{ std::invoke( f, first[ static_cast<std::iter_difference_t<Iterator>>( index ) ] ) };
+            if constexpr ( void_result ) return detail::settle( outcome, failure, []() noexcept {} );
+            else                         return detail::settle( outcome, failure, [ & ]( result && value ) { results[ index ] = std::move( value ); } );
+        }
+    };
+    detail::run_parallel( plan, failure, element );
+
+    failure.rethrow_if_exception();
+    if ( failure.failed() )
+        return detail::make_failed<target>( std::move( failure ).error() );
+    if constexpr ( void_result ) return detail::make_succeeded<target>();
+    else                         return detail::make_succeeded<target>( std::move( results ) );
+}
+
+template <std::ranges::random_access_range Range, typename F> requires std::ranges::sized_range<Range>
+auto parallel_transform( Range && range, F && f, parallel_options const options = {} )
+{
+    auto const first( std::ranges::begin( range ) );
+    return parallel_transform( first, first + std::ranges::ssize( range ), std::forward<F>( f ), options );
+}
+
+
+/// f( *iterator ) -> result_or_error<T, E> or fallible_result<T, E>
+/// reduce( T &&, T && ) -> T (has to be associative and commutative - it
+/// combines both the elements and the per-thread partial reductions, in an
+/// unspecified order, just like for std::reduce, i.e. any per-element
+/// transformation, e.g. squaring for a sum of squares, belongs in f), init is
+/// used exactly once.
+/// Returns result_or_error<T, E>.
+template <std::random_access_iterator Iterator, class T, typename F, typename Reduce>
+auto parallel_reduce( Iterator const first, Iterator const last, T init, F && f, Reduce && reduce, parallel_options const options = {} )
+{
+    using outcome = detail::parallel_outcome<F, std::iter_reference_t<Iterator>>;
+    using result  = typename detail::result_traits<outcome>::result;
+    using error   = typename detail::result_traits<outcome>::error ;
+    using target  = result_or_error<T, error>;
+    static_assert( !std::is_void_v<result>, "parallel_reduce requires a (non-void) Result." );
+    static_assert( std::is_same_v<result, T>, "parallel_reduce requires f to return Ts (reduce combines both the elements and the partial reductions - transform the elements in f)." );
+
+    detail::parallel_plan const plan( static_cast<std::size_t>( last - first ), options );
+    detail::first_failure<error> failure;
+
+    struct alignas( 64 ) partial { std::optional<T> value; }; // (no false sharing between the workers)
+    std::unique_ptr<partial[]> const partials{ new partial[ plan.workers ] };
+
+    auto element
+    {
+        [ & ]( unsigned const worker, std::size_t const index )
+        {
+            auto outcome{ std::invoke( f, first[ static_cast<std::iter_difference_t<Iterator>>( index ) ] ) };
+            return detail::settle
+            (
+                outcome, failure,
+                [ &, &accumulator = partials[ worker ].value ]( result && value )
+                {
+                    if ( BOOST_LIKELY( accumulator.has_value() ) ) accumulator = std::invoke( reduce, std::move( *accumulator ), std::move( value ) );
+                    else                                           accumulator.emplace( std::move( value ) );
+                }
+            );
+        }
+    };
+    detail::run_parallel( plan, failure, element );
+
+    failure.rethrow_if_exception();
+    if ( failure.failed() )
+        return detail::make_failed<target>( std::move( failure ).error() );
+    for ( unsigned worker{ 0 }; worker < plan.workers; ++worker )
+        if ( auto & value{ partials[ worker ].value } )
+            init = std::invoke( reduce, std::move( init ), std::move( *value ) );
+    return detail::make_succeeded<target>( std::move( init ) );
+}
+
+template <std::ranges::random_access_range Range, class T, typename F, typename Reduce> requires std::ranges::sized_range<Range>
+auto parallel_reduce( Range && range, T init, F && f, Reduce && reduce, parallel_options const options = {} )
+{
+    auto const first( std::ranges::begin( range ) );
+    return parallel_reduce( first, first + std::ranges::ssize( range ), std::move( init ), std::forward<F>( f ), std::forward<Reduce>( reduce ), options );
+}
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
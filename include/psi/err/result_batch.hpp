@@ -0,0 +1,262 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file result_batch.hpp
+/// ----------------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "fallible_result.hpp"
+#include "result_or_error.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+namespace detail
+{
+    // (uninitialised) per-slot storage - constructed/destroyed as directed by
+    // the result_batch masks
+    template <class T, std::size_t size>
+    struct batch_storage
+    {
+         batch_storage() noexcept {}
+        ~batch_storage() noexcept {}
+
+        T       & operator[]( std::size_t const index )       noexcept { return slots[ index ]; }
+        T const & operator[]( std::size_t const index ) const noexcept { return slots[ index ]; }
+
+        union { T slots[ size ]; };
+    }; // struct batch_storage
+
+    template <std::size_t size>
+    struct batch_storage<void, size> {};
+} // namespace detail
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class result_batch
+///
+/// \brief N outcomes of a batch (e.g. of submitted I/O operations) stored as
+/// structure-of-arrays: the Results, the Errors and packed success and
+/// failure bitmasks.
+///
+/// \detail The bulk queries (all_succeeded(), count_failed(),
+/// for_each_failed()) work on whole 64 bit mask words (and the constant trip
+/// count loops are trivially vectorisable) instead of branching on each
+/// element. Slots that have not been set are neither succeeded nor failed.
+/// As with result_or_error, accessing individual Results or Errors asserts
+/// that the batch was inspected first (by any of the queries) - once per
+/// batch rather than once per element. as_fallible_result() converts the
+/// whole batch to the throwing behaviour of fallible_result (with the first,
+/// i.e. lowest index, Error).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Result, class Error, std::size_t N>
+class result_batch
+{
+private:
+    using word = std::uint64_t;
+
+    static std::uint8_t constexpr word_bits   = 64;
+    static std::size_t  constexpr mask_words  = ( N + word_bits - 1 ) / word_bits;
+
+    static_assert( N > 0, "Empty batch." );
+
+    static bool constexpr nothrow_destructible{ ( std::is_void_v<Result> || std::is_nothrow_destructible_v<Result> ) && std::is_nothrow_destructible_v<Error> };
+
+public:
+    using result_type = Result;
+    using error_type  = Error ;
+
+    static std::size_t constexpr size() noexcept { return N; }
+
+    result_batch() noexcept = default;
+    result_batch( result_batch const & ) = delete;
+   ~result_batch() noexcept( nothrow_destructible ) { destroy(); }
+
+    // Filling
+    template <class R, class E>
+    void set( std::size_t const index, result_or_error<R, E> && source ) { settle( index, source ); }
+    template <class R, class E>
+    void set( std::size_t const index, fallible_result<R, E> && source ) { settle( index, detail::result_traits<fallible_result<R, E>>::source( source ) ); }
+
+    template <typename ... Args>
+    void emplace_result( std::size_t const index, Args && ... args ) noexcept( std::is_void_v<Result> || std::is_nothrow_constructible_v<Result, Args &&...> )
+    {
+        BOOST_ASSERT_MSG( is_empty( index ), "Slot already set." );
+        if constexpr ( !std::is_void_v<Result> )
+            std::construct_at( &results_[ index ], std::forward<Args>( args )... );
+        set_bit( succeeded_, index );
+    }
+
+    template <typename ... Args>
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    void emplace_error( std::size_t const index, Args && ... args ) noexcept( std::is_nothrow_constructible_v<Error, Args &&...> )
+    {
+        BOOST_ASSERT_MSG( is_empty( index ), "Slot already set." );
+        std::construct_at( &errors_[ index ], std::forward<Args>( args )... );
+        set_bit( failed_, index );
+    }
+
+    /// Destroys all the stored outcomes (for reuse of the batch).
+    void clear() noexcept( nothrow_destructible )
+    {
+        destroy();
+        for ( std::size_t w{ 0 }; w < mask_words; ++w )
+            succeeded_[ w ] = failed_[ w ] = 0;
+        inspected_ = false;
+    }
+
+    // Inspection (bulk)
+    [[ gnu::pure ]] bool all_succeeded() const noexcept
+    {
+        inspected_ = true;
+        word any_failed{ 0 };
+        for ( std::size_t w{ 0 }; w < mask_words; ++w )
+            any_failed |= failed_[ w ];
+        return BOOST_LIKELY( !any_failed );
+    }
+
+    [[ gnu::pure ]] std::size_t count_failed() const noexcept
+    {
+        inspected_ = true;
+        std::size_t count{ 0 };
+        for ( std::size_t w{ 0 }; w < mask_words; ++w )
+            count += static_cast<std::size_t>( std::popcount( failed_[ w ] ) );
+        return count;
+    }
+
+    [[ gnu::pure ]] std::size_t count_succeeded() const noexcept
+    {
+        inspected_ = true;
+        std::size_t count{ 0 };
+        for ( std::size_t w{ 0 }; w < mask_words; ++w )
+            count += static_cast<std::size_t>( std::popcount( succeeded_[ w ] ) );
+        return count;
+    }
+
+    /// Calls visitor( index, Error & ) for every failed slot (in index order).
+    template <typename Visitor>
+    void for_each_failed( Visitor && visitor ) noexcept( noexcept( visitor( std::size_t{}, std::declval<Error &>() ) ) )
+    {
+        inspected_ = true;
+        for ( std::size_t w{ 0 }; w < mask_words; ++w )
+        {
+            for ( auto bits{ failed_[ w ] }; bits; bits &= bits - 1 )
+            {
+                auto const index( w * word_bits + static_cast<std::size_t>( std::countr_zero( bits ) ) );
+                visitor( index, errors_[ index ] );
+            }
+        }
+    }
+
+    /// The index of the first failed slot or size() if none failed.
+    [[ gnu::pure ]] std::size_t first_failed() const noexcept
+    {
+        inspected_ = true;
+        for ( std::size_t w{ 0 }; w < mask_words; ++w )
+            if ( failed_[ w ] ) [[ unlikely ]]
+                return w * word_bits + static_cast<std::size_t>( std::countr_zero( failed_[ w ] ) );
+        return N;
+    }
+
+    // Inspection (per slot)
+    [[ gnu::pure ]] bool succeeded( std::size_t const index ) const noexcept { inspected_ = true; return test_bit( succeeded_, index ); }
+    [[ gnu::pure ]] bool failed   ( std::size_t const index ) const noexcept { inspected_ = true; return test_bit( failed_   , index ); }
+    [[ gnu::pure ]] bool inspected(                         ) const noexcept { return inspected_; }
+
+    auto         & result( std::size_t const index )       noexcept requires( !std::is_void_v<Result> ) { BOOST_ASSERT_MSG( inspected(), "Using a result_batch w/o prior inspection" ); BOOST_ASSERT_MSG( test_bit( succeeded_, index ), "Querying the result of a failed (or unset) operation." ); return results_[ index ]; }
+    auto   const & result( std::size_t const index ) const noexcept requires( !std::is_void_v<Result> ) { return const_cast<result_batch &>( *this ).result( index ); }
+    Error        & error ( std::size_t const index )       noexcept { BOOST_ASSERT_MSG( inspected(), "Using a result_batch w/o prior inspection" ); BOOST_ASSERT_MSG( test_bit( failed_, index ), "Querying the error of a succeeded (or unset) operation." ); return errors_[ index ]; }
+    Error  const & error ( std::size_t const index ) const noexcept { return const_cast<result_batch &>( *this ).error( index ); }
+
+    /// Moves out the first Error (if any): the returned fallible_result throws
+    /// it if left uninspected.
+    fallible_result<void, Error> as_fallible_result() noexcept( std::is_nothrow_move_constructible_v<Error> )
+    {
+        auto const index( first_failed() );
+        if ( BOOST_LIKELY( index == N ) )
+            return no_err;
+        return std::move( errors_[ index ] );
+    }
+
+    void throw_if_error()
+    {
+        auto const index( first_failed() );
+        if ( BOOST_LIKELY( index == N ) )
+            return;
+        throw_error( index );
+    }
+
+private:
+    template <class Source>
+    void settle( std::size_t const index, Source & source )
+    {
+        if ( source.succeeded() ) [[ likely ]]
+        {
+            if constexpr ( std::is_void_v<Result> ) { std::move( source ).assume_succeeded(); emplace_result( index ); }
+            else                                      emplace_result( index, std::move( source ).assume_succeeded() );
+        }
+        else
+            emplace_error( index, std::move( source ).error() );
+    }
+
+    [[ noreturn ]] BOOST_ATTRIBUTES( BOOST_COLD )
+    void throw_error( std::size_t const index ) { detail::throw_error( errors_[ index ] ); }
+
+    void destroy() noexcept( nothrow_destructible )
+    {
+        if constexpr ( !std::is_void_v<Result> && !std::is_trivially_destructible_v<Result> )
+            for_each_set( succeeded_, [ this ]( std::size_t const index ) { std::destroy_at( &results_[ index ] ); } );
+        if constexpr ( !std::is_trivially_destructible_v<Error> )
+            for_each_set( failed_   , [ this ]( std::size_t const index ) { std::destroy_at( &errors_ [ index ] ); } );
+    }
+
+    template <typename F>
+    static void for_each_set( word const ( & mask )[ mask_words ], F && f )
+    {
+        for ( std::size_t w{ 0 }; w < mask_words; ++w )
+            for ( auto bits{ mask[ w ] }; bits; bits &= bits - 1 )
+                f( w * word_bits + static_cast<std::size_t>( std::countr_zero( bits ) ) );
+    }
+
+    static bool test_bit( word const ( & mask )[ mask_words ], std::size_t const index ) noexcept { BOOST_ASSERT( index < N ); return ( mask[ index / word_bits ] >> ( index % word_bits ) ) & 1; }
+    static void set_bit ( word       ( & mask )[ mask_words ], std::size_t const index ) noexcept { BOOST_ASSERT( index < N ); mask[ index / word_bits ] |= word{ 1 } << ( index % word_bits ); }
+
+    bool is_empty( std::size_t const index ) const noexcept { return !test_bit( succeeded_, index ) && !test_bit( failed_, index ); }
+
+    word succeeded_[ mask_words ]{};
+    word failed_   [ mask_words ]{};
+
+    detail::batch_storage<Result, N> results_;
+    detail::batch_storage<Error , N> errors_ ;
+
+    mutable bool inspected_{ false };
+}; // class result_batch
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
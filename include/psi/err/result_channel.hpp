@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file result_channel.hpp
+/// ------------------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "fallible_result.hpp"
+#include "result_or_error.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+template <class Result, class Error> class result_promise;
+template <class Result, class Error> class result_future;
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class result_channel
+///
+/// \brief A single-producer/single-consumer slot for handing a Result or an
+/// Error over to another thread - a non-allocating promise/future pair.
+///
+/// \detail The Result or Error is stored inline (the whole channel occupies a
+/// cache line for small payloads) and completion is signalled through a 32
+/// bit atomic (i.e. std::atomic::wait/notify map directly to a futex or
+/// WaitOnAddress). Nothing is allocated and the Error stays an Error: it only
+/// becomes an exception on the consumer side if the consumer converts the
+/// received outcome to a fallible_result (or the Result) - compare with
+/// result_or_error::make_exception_ptr().
+/// The channel is reusable: receiving empties it and the producer can then
+/// set the next outcome (wait_empty() blocks until the consumer has taken the
+/// previous one). The channel has to outlive the promise and future handles
+/// (its destructor waits for a concurrent receive()/set*() to return from
+/// notifying the other side).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Result, class Error>
+class alignas( 64 ) result_channel
+{
+private:
+    using target = result_or_error<Result, Error>;
+
+public:
+    result_channel() noexcept {}
+    result_channel( result_channel const & ) = delete;
+   ~result_channel() noexcept( ( std::is_void_v<Result> || std::is_nothrow_destructible_v<Result> ) && std::is_nothrow_destructible_v<Error> )
+    {
+        while ( BOOST_UNLIKELY( notifying_.load( std::memory_order_acquire ) ) )
+            std::this_thread::yield();
+        destroy( state_.load( std::memory_order_acquire ) );
+    }
+
+    result_promise<Result, Error> promise() noexcept { return result_promise<Result, Error>{ *this }; }
+    result_future <Result, Error> future () noexcept { return result_future <Result, Error>{ *this }; }
+
+    // Producer
+    template <typename ... Args>
+    void set_result( Args && ... args ) noexcept( std::is_void_v<Result> || std::is_nothrow_constructible_v<Result, Args &&...> )
+    {
+        BOOST_ASSERT_MSG( state_.load( std::memory_order_relaxed ) == empty, "Channel already holds an (unreceived) outcome." );
+        if constexpr ( !std::is_void_v<Result> )
+            std::construct_at( &result_, std::forward<Args>( args )... );
+        complete( succeeded );
+    }
+
+    template <typename ... Args>
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    void set_error( Args && ... args ) noexcept( std::is_nothrow_constructible_v<Error, Args &&...> )
+    {
+        BOOST_ASSERT_MSG( state_.load( std::memory_order_relaxed ) == empty, "Channel already holds an (unreceived) outcome." );
+        std::construct_at( &error_, std::forward<Args>( args )... );
+        complete( failed );
+    }
+
+    template <class R, class E> void set( result_or_error<R, E> && source ) { settle( source ); }
+    template <class R, class E> void set( fallible_result<R, E> && source ) { settle( detail::result_traits<fallible_result<R, E>>::source( source ) ); }
+
+    void wait_empty() const noexcept
+    {
+        for ( auto state{ state_.load( std::memory_order_acquire ) }; state != empty; state = state_.load( std::memory_order_acquire ) )
+            state_.wait( state, std::memory_order_acquire );
+    }
+
+    // Consumer
+    bool ready() const noexcept { return state_.load( std::memory_order_acquire ) != empty; }
+
+    void wait() const noexcept
+    {
+        while ( state_.load( std::memory_order_acquire ) == empty )
+            state_.wait( empty, std::memory_order_acquire );
+    }
+
+    /// Blocks until the outcome is set and moves it out (emptying the channel).
+    target receive() noexcept( ( std::is_void_v<Result> || std::is_nothrow_move_constructible_v<Result> ) && std::is_nothrow_move_constructible_v<Error> )
+    {
+        wait();
+        consume_on_exit const consume{ *this };
+        if ( BOOST_LIKELY( state_.load( std::memory_order_relaxed ) == succeeded ) )
+        {
+            if constexpr ( std::is_void_v<Result> ) return detail::make_succeeded<target>();
+            else                                    return detail::make_succeeded<target>( std::move( result_ ) );
+        }
+        return detail::make_failed<target>( std::move( error_ ) );
+    }
+
+    /// As receive() but the Error is thrown if the (returned) fallible_result
+    /// is left uninspected or converted to the Result.
+    fallible_result<Result, Error> receive_fallible() { return receive().as_fallible_result(); }
+
+private:
+    using state_t = std::uint32_t;
+
+    static state_t constexpr empty     = 0;
+    static state_t constexpr succeeded = 1;
+    static state_t constexpr failed    = 2;
+
+    struct consume_on_exit
+    {
+        result_channel & channel;
+        ~consume_on_exit() noexcept
+        {
+            channel.destroy( channel.state_.load( std::memory_order_relaxed ) );
+            channel.complete( empty ); // (a producer blocked in wait_empty())
+        }
+    }; // struct consume_on_exit
+
+    template <class Source>
+    void settle( Source & source )
+    {
+        if ( source.succeeded() ) [[ likely ]]
+        {
+            if constexpr ( std::is_void_v<Result> ) { std::move( source ).assume_succeeded(); set_result(); }
+            else                                      set_result( std::move( source ).assume_succeeded() );
+        }
+        else
+            set_error( std::move( source ).error() );
+    }
+
+    // The side that observes the store may go on to destroy the channel while
+    // this one is still inside notify_one(): notifying_ keeps the destructor
+    // waiting until it returns.
+    void complete( state_t const state ) noexcept
+    {
+        notifying_.fetch_add( 1, std::memory_order_relaxed );
+        state_.store( state, std::memory_order_release );
+        state_.notify_one();
+        notifying_.fetch_sub( 1, std::memory_order_release );
+    }
+
+    void destroy( state_t const state ) noexcept
+    {
+        if constexpr ( !std::is_void_v<Result> )
+            if ( state == succeeded ) { std::destroy_at( &result_ ); return; }
+        if ( state == failed ) std::destroy_at( &error_ );
+    }
+
+    std::atomic<state_t> mutable state_    { empty };
+    std::atomic<state_t>         notifying_{ 0     };
+    union
+    {
+        std::conditional_t<std::is_void_v<Result>, no_err_t, Result> result_;
+        Error                                                        error_ ;
+    };
+}; // class result_channel
+
+
+/// The producer end of a result_channel.
+template <class Result, class Error>
+class result_promise
+{
+public:
+    template <typename ... Args> void set_result( Args && ... args ) { channel_.set_result( std::forward<Args>( args )... ); }
+    template <typename ... Args> void set_error ( Args && ... args ) { channel_.set_error ( std::forward<Args>( args )... ); }
+    template <class Source>      void set       ( Source && source  ) { channel_.set       ( std::forward<Source>( source ) ); }
+
+    void wait_empty() const noexcept { channel_.wait_empty(); }
+
+private: friend class result_channel<Result, Error>;
+    explicit result_promise( result_channel<Result, Error> & channel ) noexcept : channel_( channel ) {}
+
+    result_channel<Result, Error> & channel_;
+}; // class result_promise
+
+/// The consumer end of a result_channel.
+template <class Result, class Error>
+class result_future
+{
+public:
+    bool ready() const noexcept { return channel_.ready(); }
+    void wait () const noexcept { channel_.wait (); }
+
+    result_or_error<Result, Error> get         () { return channel_.receive         (); }
+    fallible_result<Result, Error> get_fallible() { return channel_.receive_fallible(); }
+
+private: friend class result_channel<Result, Error>;
+    explicit result_future( result_channel<Result, Error> & channel ) noexcept : channel_( channel ) {}
+
+    result_channel<Result, Error> & channel_;
+}; // class result_future
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
@@ -18,11 +18,28 @@
 //------------------------------------------------------------------------------
 #include "exceptions.hpp"
 
+/// PSI_ERR_ERROR_STATISTICS: see error_statistics.hpp.
+#ifndef PSI_ERR_ERROR_STATISTICS
+#   define PSI_ERR_ERROR_STATISTICS 0
+#endif // PSI_ERR_ERROR_STATISTICS
+#if PSI_ERR_ERROR_STATISTICS
+#include "error_statistics.hpp"
+#endif // PSI_ERR_ERROR_STATISTICS
+
 #include <boost/assert.hpp>
 #include <boost/config_ex.hpp>
 
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <source_location>
 #include <type_traits>
 #include <utility>
+#include <version>
+#if __cpp_lib_expected
+#include <expected>
+#endif // __cpp_lib_expected
 //------------------------------------------------------------------------------
 namespace psi::err
 {
@@ -45,14 +62,568 @@ inline an_err_t constexpr failure = {};
 inline an_err_t constexpr failed  = {};
 
 
+////////////////////////////////////////////////////////////////////////////////
+//
+// The type traits evaluated for every Result type (the specialisation
+// selection, the conditionally trivial special members, the constructor
+// constraints and noexcept specifications): through the compiler intrinsics
+// where available - the std trait class templates (instantiated, along with
+// their completeness checks, per Result type with e.g. libstdc++) otherwise
+// dominate the cost of a result_or_error instantiation.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __has_builtin
+#   define PSI_ERR_HAS_BUILTIN( builtin ) __has_builtin( builtin )
+#else
+#   define PSI_ERR_HAS_BUILTIN( builtin ) 0
+#endif // __has_builtin
+
+namespace detail
+{
+#if PSI_ERR_HAS_BUILTIN( __is_constructible )
+    template <class T, class ... Args> bool constexpr is_constructible_v{ __is_constructible( T, Args... ) };
+#else
+    template <class T, class ... Args> bool constexpr is_constructible_v{ std::is_constructible_v<T, Args...> };
+#endif
+    // (GCC 11 and 12 do support but do not report the intrinsic)
+#if PSI_ERR_HAS_BUILTIN( __is_nothrow_constructible ) || ( defined( __GNUC__ ) && !defined( __clang__ ) && __GNUC__ >= 11 )
+    template <class T, class ... Args> bool constexpr is_nothrow_constructible_v{ __is_nothrow_constructible( T, Args... ) };
+#else
+    template <class T, class ... Args> bool constexpr is_nothrow_constructible_v{ std::is_nothrow_constructible_v<T, Args...> };
+#endif
+#if PSI_ERR_HAS_BUILTIN( __is_trivially_constructible )
+    template <class T, class ... Args> bool constexpr is_trivially_constructible_v{ __is_trivially_constructible( T, Args... ) };
+#else
+    template <class T, class ... Args> bool constexpr is_trivially_constructible_v{ std::is_trivially_constructible_v<T, Args...> };
+#endif
+#if PSI_ERR_HAS_BUILTIN( __is_trivially_copyable )
+    template <class T> bool constexpr is_trivially_copyable_v{ __is_trivially_copyable( T ) };
+#else
+    template <class T> bool constexpr is_trivially_copyable_v{ std::is_trivially_copyable_v<T> };
+#endif
+#if PSI_ERR_HAS_BUILTIN( __is_trivially_destructible )
+    template <class T> bool constexpr is_trivially_destructible_v{ __is_trivially_destructible( T ) };
+#elif PSI_ERR_HAS_BUILTIN( __has_trivial_destructor )
+    template <class T> bool constexpr is_trivially_destructible_v{ __has_trivial_destructor( T ) };
+#else
+    template <class T> bool constexpr is_trivially_destructible_v{ std::is_trivially_destructible_v<T> };
+#endif
+#if PSI_ERR_HAS_BUILTIN( __is_convertible )
+    template <class From, class To> bool constexpr is_convertible_v{ __is_convertible( From, To ) };
+#else
+    template <class From, class To> bool constexpr is_convertible_v{ std::is_convertible_v<From, To> };
+#endif
+#if PSI_ERR_HAS_BUILTIN( __is_empty )
+    template <class T> bool constexpr is_empty_v{ __is_empty( T ) };
+#else
+    template <class T> bool constexpr is_empty_v{ std::is_empty_v<T> };
+#endif
+
+    template <class T> bool constexpr is_default_constructible_v        { is_constructible_v        <T> };
+    template <class T> bool constexpr is_nothrow_default_constructible_v{ is_nothrow_constructible_v<T> };
+    template <class T> bool constexpr is_nothrow_move_constructible_v   { is_nothrow_constructible_v<T, T &&> };
+    template <class T> bool constexpr is_trivially_move_constructible_v { is_trivially_constructible_v<T, T &&> };
+    template <class T> bool constexpr is_trivially_default_constructible_v{ is_trivially_constructible_v<T> };
+} // namespace detail
+
+namespace detail
+{
+    /// \note With (conditionally) trivial move constructors the source of a
+    /// move no longer gets implicitly marked as inspected (nor the target as
+    /// uninspected) so the 'moving out' functions do it explicitly: the flag of
+    /// the source is set only after the return value has been constructed
+    /// (from the, still uninspected, source).
+    struct inspect_on_exit
+    {
+        bool & inspected;
+        constexpr ~inspect_on_exit() noexcept { inspected = true; }
+    };
+
+    // GCC 12 (and older) rejects reads of the mutable inspected_ flags during
+    // constant evaluation (it accepts the writes) so the inspection checks
+    // (assertions and the implicit throw of an uninspected failure) are
+    // skipped there.
+    constexpr bool unchecked_inspection() noexcept { return std::is_constant_evaluated(); }
+
+    // The failed_result_pending() state of a fallible_result (see
+    // fallible_result.hpp) - stored, next to the inspected_ flag, in (the
+    // padding of) the wrapped result_or_error.
+    enum struct pending_failure : std::uint8_t
+    {
+        none,
+        first,    ///< no other failure was pending when this one was created
+        follow_up ///< created while another failure was pending (e.g. an early return due to failed_result_pending())
+    }; // enum struct pending_failure
+
+    template <class Result, class Error>
+    concept trivially_destructible =
+        detail::is_trivially_destructible_v<Result> &&
+        detail::is_trivially_destructible_v<Error >;
+
+    /// The construction site of a failed result (a defaulted trailing
+    /// constructor parameter: unused and optimised away unless the sanitizer
+    /// or error statistics are enabled).
+    struct call_site
+    {
+        constexpr call_site( std::source_location const construction = std::source_location::current() ) noexcept : location( construction ) {}
+
+        std::source_location location;
+    }; // struct call_site
+
+    template <class Error>
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    constexpr void record_failure( [[ maybe_unused ]] Error const & error, [[ maybe_unused ]] call_site const & site ) noexcept
+    {
+    #if PSI_ERR_ERROR_STATISTICS
+        if ( !std::is_constant_evaluated() )
+            count_failure( error, site.location );
+    #endif // PSI_ERR_ERROR_STATISTICS
+    }
+
+    template <class Error>
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    void record_throw( [[ maybe_unused ]] Error const & error ) noexcept
+    {
+    #if PSI_ERR_ERROR_STATISTICS
+        count_throw( error );
+    #endif // PSI_ERR_ERROR_STATISTICS
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // The out-of-line throwers: templated only on the Error (i.e. one instance
+    // per Error type regardless of the number of Result types it is used with)
+    // so that the inline footprint of the throw_if_* members is just a test
+    // and a call. Deliberately not constexpr: a (constexpr) throw_if_error()
+    // on a failed result in a constant expression thus fails to compile.
+    ////////////////////////////////////////////////////////////////////////////
+
+    template <class Error>
+    [[ noreturn ]] BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+    void BOOST_CC_REG throw_error( Error & error ) { record_throw( error ); make_and_throw_exception( std::move( error ) ); }
+
+    // for Errors that are (re)created on demand (the compressed and niche
+    // specialisations)
+    template <class Error>
+    [[ noreturn ]] BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+    void BOOST_CC_REG throw_error() { Error error{}; throw_error( error ); }
+
+    template <class Error>
+    BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+    void BOOST_CC_REG conditional_throw_error() { if ( BOOST_LIKELY( !uncaught_exceptions() ) ) throw_error<Error>(); }
+
+    template <class Error>
+    BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+    std::exception_ptr BOOST_CC_REG error_exception_ptr( Error & error ) noexcept { return err::make_exception_ptr( std::move( error ) ); }
+
+    template <class Error>
+    BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+    std::exception_ptr BOOST_CC_REG error_exception_ptr() noexcept { return err::make_exception_ptr( Error{} ); }
+
+    template <class Result, class Error>
+    concept trivially_move_constructible =
+        detail::is_trivially_move_constructible_v<Result> &&
+        detail::is_trivially_move_constructible_v<Error >;
+} // namespace detail
+
+// (the specialisation selection traits are concepts: their conjunctions
+// short-circuit, i.e. evaluate only the traits up to the first unsatisfied one)
 template <class Result, class Error>
-bool constexpr compressed_result_error_variant
+concept compressed_result_error_variant =
+    detail::is_empty_v                <Error       > &&
+    !std::is_fundamental_v         <Result      > && // 'fundamentals' implicitly convert to bool for all of their values so we have to exclude them
+    detail::is_convertible_v          <Result, bool> &&
+    detail::is_default_constructible_v<Result      >;   //...mrmlj...todo/track std::is_explicitly_convertible
+
+template <class Result, class Error> class fallible_result;
+
+namespace detail
+{
+    template <class T>
+    bool constexpr is_fallible_result{ false };
+    template <class Result, class Error>
+    bool constexpr is_fallible_result<fallible_result<Result, Error>>{ true };
+
+    // Source constructs Target - and for a Source that constructs both Target
+    // and Other: the implicit conversion is preferred over an explicit one
+    // (e.g. a last_errno source and a traced<last_errno> Error with an int
+    // Result - see the last_errno::operator value_type note). fallible_results
+    // are not sources (they convert through operator result_or_error &&, i.e.
+    // not through the throwing operator Result &&).
+    // (the cheap, non instantiating checks go first: an Other source, i.e.
+    // the most common case, is rejected before any of the constructibility
+    // traits get instantiated)
+    template <class Source, class Target, class Other>
+    concept preferred_source =
+        !std::is_same_v<std::remove_cvref_t<Source>, Other> &&
+        !is_fallible_result<std::remove_cvref_t<Source>> &&
+        detail::is_constructible_v<Target, Source &&> &&
+        ( std::is_same_v<std::remove_cvref_t<Source>, Target> || detail::is_convertible_v<Source &&, Target> || !detail::is_constructible_v<Other, Source &&> );
+
+    // (fallible_result) constructor arguments that construct a failed result
+    // (that stores the Error - i.e. not the 'compressed' specialisation)
+    template <class Source, class Result, class Error>
+    concept error_source =
+        !compressed_result_error_variant<Result, Error> &&
+        preferred_source<Source, Error, Result>         &&
+        ( std::is_same_v<std::remove_cvref_t<Source>, Error> || !detail::is_constructible_v<Result, Source &&> || !detail::is_convertible_v<Source &&, Result> );
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \struct niche_traits
+///
+/// \brief Customisation point for Result types which have a value that by
+/// itself signals failure (e.g. -1 for file descriptors, nullptr,
+/// INVALID_HANDLE_VALUE).
+///
+/// \detail Specialisations have to provide
+///     static Result invalid() noexcept;
+/// and can optionally provide (otherwise != invalid() is used)
+///     static bool   is_valid( Result const & ) noexcept;
+/// e.g.
+///     template <> struct niche_traits<file_handle>
+///     {
+///         static file_handle invalid() noexcept { return file_handle{ -1 }; }
+///     };
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Result>
+struct niche_traits {};
+
+namespace detail
 {
-    std::is_empty_v                <Error       > &&
-    std::is_convertible_v          <Result, bool> &&
-    std::is_default_constructible_v<Result      > &&
-    !std::is_fundamental_v         <Result      >    // 'fundamentals' implicitly convert to bool for all of their values so we have to exclude them
-}; //...mrmlj...todo/track std::is_explicitly_convertible
+    template <class Result>
+    constexpr bool niche_is_valid( Result const & result ) noexcept
+    {
+        if constexpr ( requires { niche_traits<Result>::is_valid( result ); } )
+            return niche_traits<Result>::is_valid( result );
+        else
+            return !( result == niche_traits<Result>::invalid() );
+    }
+} // namespace detail
+
+/// Opt-in for the niche layout for non-empty Errors which nonetheless hold
+/// no state of their own, i.e. which (re)read the thread's 'last error' on
+/// construction so that an Error() recreated on demand is the stored one (the
+/// niche layout drops the Error, e.g. last_errno captures the errno value so
+/// it is not one - current_errno and current_win32_error are).
+template <class Error>
+bool constexpr is_stateless_error{ detail::is_empty_v<Error> };
+
+template <class Result, class Error>
+concept niche_result_error_variant =
+    is_stateless_error<Error> &&
+    requires { { niche_traits<Result>::invalid() } -> std::convertible_to<Result>; } &&
+    detail::is_default_constructible_v<Error> &&
+    !compressed_result_error_variant<Result, Error>;
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \struct sentinel_traits
+///
+/// \brief Opt-in for the 'sentinel-packed' result_or_error layout, for
+/// trivially copyable Errors with a 'no error' value (i.e. which provide a
+/// static no_error constant, construction from and an explicit conversion to
+/// their value_type - e.g. last_errno, errno_code, last_win32_error).
+///
+/// \detail Specialisations have to provide
+///     static value_type const unknown_error;
+/// an error value that replaces the no_error value of a failure constructed
+/// from one (e.g. a last_errno captured after an API that failed without
+/// setting errno) - in all of the layouts so a failure is a failure (with the
+/// same Error) regardless of the selected layout, e.g.
+///     template <> struct sentinel_traits<my_error>
+///     {
+///         static my_error::value_type constexpr unknown_error = -1;
+///     };
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Error>
+struct sentinel_traits {};
+
+namespace detail
+{
+    template <class Error>
+    concept sentinel_error =
+        requires
+        {
+            sentinel_traits<Error>::unknown_error;
+            Error::no_error;
+            Error{ Error::no_error };
+            static_cast<typename Error::value_type>( std::declval<Error const &>() );
+        } &&
+        detail::is_trivially_copyable_v<Error>;
+
+    template <class Result, class Error>
+    concept sentinel_layout_candidate =
+        sentinel_error<Error> &&
+        detail::is_trivially_copyable_v             <Result> &&
+        detail::is_trivially_default_constructible_v<Result>;
+
+    template <class Result, class Error>
+    constexpr bool sentinel_layout_fits() noexcept
+    {
+        if constexpr ( sentinel_layout_candidate<Result, Error> )
+        {
+            // only worth it if storing the Result and the Error side by side
+            // (and dropping the succeeded_ discriminator) does not grow the
+            // object (the behaviour is the same either way)
+            struct packed   {         Result result;   Error error;                  bool inspected; pending_failure pending; };
+            struct unpacked { union { Result result;   Error error; }; bool succeeded; bool inspected; pending_failure pending; };
+            return sizeof( packed ) <= sizeof( unpacked );
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // (only the no_error value: APIs with multiple success values, e.g.
+    // HRESULT's S_FALSE, are translated at the call boundary - see
+    // from_hresult())
+    template <class Error>
+    constexpr bool sentinel_is_success( Error const & error ) noexcept
+    {
+        return static_cast<typename Error::value_type>( error ) == Error::no_error;
+    }
+
+    // (see sentinel_traits - called by the failure constructors of all the
+    // layouts that store the Error)
+    template <class Error>
+    constexpr void replace_no_error( Error & error ) noexcept
+    {
+        if constexpr ( sentinel_error<Error> )
+        {
+            if ( sentinel_is_success( error ) ) [[ unlikely ]]
+                std::construct_at( &error, Error{ sentinel_traits<Error>::unknown_error } );
+        }
+    }
+} // namespace detail
+
+template <class Result, class Error>
+concept sentinel_result_error_variant =
+    !compressed_result_error_variant<Result, Error> &&
+    !niche_result_error_variant     <Result, Error> &&
+    detail::sentinel_layout_fits    <Result, Error>();
+
+
+template <class Result, class Error> class result_or_error;
+
+namespace detail
+{
+    // Result, Error and the rebinding of chained results (specialised for
+    // result_or_error below and for fallible_result in fallible_result.hpp)
+    template <class T>
+    struct result_traits;
+
+    template <class F, class Source>
+    constexpr decltype( auto ) invoke_on_result( F && f, Source & source )
+    {
+        if constexpr ( std::is_void_v<typename result_traits<Source>::result> )
+        {
+            std::move( source ).assume_succeeded();
+            return std::invoke( std::forward<F>( f ) );
+        }
+        else
+            return std::invoke( std::forward<F>( f ), std::move( source ).assume_succeeded() );
+    }
+
+    template <class Target, class ... Args>
+    constexpr Target make_succeeded( Args && ... args )
+    {
+        if constexpr ( std::is_void_v<typename result_traits<Target>::result> ) return Target( no_err );
+        else                                                                    return Target( std::in_place, std::forward<Args>( args )... );
+    }
+
+    template <class Target, class Source>
+    constexpr Target make_failed( Source && error )
+    {
+        using result = typename result_traits<Target>::result;
+        using error_t = typename result_traits<Target>::error ;
+        if constexpr ( compressed_result_error_variant<result, error_t> )
+        {
+            static_cast<void>( error );
+            return Target( std::in_place ); // the default constructed ('false') Result
+        }
+        else
+            return Target( std::in_place_type<error_t>, std::forward<Source>( error ) );
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///
+    /// \class combinators
+    ///
+    /// \brief Monadic and_then, transform, or_else and value_or for (rvalue)
+    /// result_or_errors and fallible_results.
+    ///
+    /// \detail Each stage inspects its source exactly once and constructs its
+    /// return value directly (in place) from the continuation so that a chain
+    /// compiles down to a straight sequence of branches. The Result is passed
+    /// to the continuation by rvalue reference (i.e. it is moved at most once
+    /// per stage - when the continuation consumes it). For fallible_result
+    /// sources the chain returns fallible_results (i.e. the last one still
+    /// throws if left uninspected).
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    template <class Derived>
+    class combinators
+    {
+    public:
+        /// f( Result && ) -> result_or_error<U, E> or fallible_result<U, E>
+        template <typename F>
+        constexpr auto and_then( F && f ) &&
+        {
+            auto & source( this->source() );
+            using chained = std::remove_cvref_t<decltype( invoke_on_result( std::forward<F>( f ), source ) )>;
+            using target  = typename result_traits<Derived>::template rebind<chained>;
+            if ( source.succeeded() ) [[ likely ]]
+                return target( invoke_on_result( std::forward<F>( f ), source ) );
+            return make_failed<target>( std::move( source ).error() );
+        }
+
+        /// f( Result && ) -> U
+        template <typename F>
+        constexpr auto transform( F && f ) &&
+        {
+            auto & source( this->source() );
+            using mapped = std::remove_cvref_t<decltype( invoke_on_result( std::forward<F>( f ), source ) )>;
+            using target = typename result_traits<Derived>::template rebind<result_or_error<mapped, typename result_traits<Derived>::error>>;
+            if ( source.succeeded() ) [[ likely ]]
+            {
+                if constexpr ( std::is_void_v<mapped> )
+                {
+                    invoke_on_result( std::forward<F>( f ), source );
+                    return target( no_err );
+                }
+                else
+                    return target( std::in_place, invoke_on_result( std::forward<F>( f ), source ) );
+            }
+            return make_failed<target>( std::move( source ).error() );
+        }
+
+        /// f( Error && ) -> result_or_error<Result, E> or fallible_result<Result, E>
+        template <typename F>
+        constexpr auto or_else( F && f ) &&
+        {
+            auto & source( this->source() );
+            using chained = std::remove_cvref_t<std::invoke_result_t<F &&, decltype( std::move( source ).error() )>>;
+            using target  = typename result_traits<Derived>::template rebind<chained>;
+            static_assert( std::is_same_v<typename result_traits<chained>::result, typename result_traits<Derived>::result>, "or_else continuations have to return the same Result type." );
+            if ( source.succeeded() ) [[ likely ]]
+            {
+                if constexpr ( std::is_void_v<typename result_traits<Derived>::result> )
+                {
+                    std::move( source ).assume_succeeded();
+                    return make_succeeded<target>();
+                }
+                else
+                    return make_succeeded<target>( std::move( source ).assume_succeeded() );
+            }
+            return target( std::invoke( std::forward<F>( f ), std::move( source ).error() ) );
+        }
+
+        template <typename Default>
+        constexpr auto value_or( Default && default_value ) &&
+        {
+            using result = typename result_traits<Derived>::result;
+            static_assert( !std::is_void_v<result>, "value_or requires a (non-void) Result." );
+            auto & source( this->source() );
+            if ( source.succeeded() ) [[ likely ]]
+                return result( std::move( source ).assume_succeeded() );
+            return static_cast<result>( std::forward<Default>( default_value ) );
+        }
+
+    private:
+        constexpr auto & source() noexcept { return result_traits<Derived>::source( static_cast<Derived &>( *this ) ); }
+    }; // class combinators
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///
+    /// \class result_core
+    ///
+    /// \brief The members shared by all the result_or_error specialisations
+    /// (defined once in terms of the ones that differ).
+    ///
+    /// \detail A specialisation (a friend) provides the inspected_ flag,
+    /// succeeded(), result() (for non-void Results), throw_error() and the
+    /// (protected) move constructor. The return types are deduced so that the
+    /// members which are never used cost (next to) nothing per instantiation.
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    template <class Derived>
+    class result_core : public combinators<Derived>
+    {
+    public:
+        // See the note for propagate in fallible_result. For result_or_error
+        // the unexpected/buggy behaviour NRVO may manifest is:
+        //  - failure to get an assertion failure that you forgot to inspect
+        //    the state of the result before calling result() or error()
+        //    getters
+        //  - throw_if_uninspected_error() might not throw when it should
+        constexpr Derived propagate() noexcept( nothrow_movable() ) { auto & self( this->self() ); self.inspected_ = false; inspect_on_exit const inspected{ self.inspected_ }; return std::move( self ); }
+
+        constexpr auto as_fallible_result() noexcept( nothrow_movable() ) { return fallible_result<typename result_traits<Derived>::result, typename result_traits<Derived>::error>( std::move( self() ) ); }
+
+        constexpr decltype( auto ) operator *  ()       && noexcept { return std::move     ( self().result() ); }
+        constexpr decltype( auto ) operator *  ()       &  noexcept { return                 self().result()  ; }
+        constexpr decltype( auto ) operator *  () const &  noexcept { return                 self().result()  ; }
+        constexpr auto             operator -> ()          noexcept { return std::addressof( self().result() ); }
+        constexpr auto             operator -> () const    noexcept { return std::addressof( self().result() ); }
+
+        constexpr explicit operator bool () BOOST_RESTRICTED_THIS const noexcept { return self().succeeded(); }
+
+        // (hidden friends - i.e. no namespace scope templates for every
+        // comparison in the program to deduce - the != and the reversed
+        // forms are rewritten from these)
+        friend constexpr bool operator==( Derived const & result, no_err_t ) noexcept { return  result.succeeded(); }
+        friend constexpr bool operator==( Derived const & result, an_err_t ) noexcept { return !result.succeeded(); }
+
+        constexpr decltype( auto ) assume_succeeded() && noexcept
+        {
+            BOOST_ASSUME( self().succeeded() );
+            if constexpr ( std::is_void_v<typename result_traits<Derived>::result> ) return;
+            else                                                                     return std::move( self().result() );
+        }
+
+    BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
+        BOOST_ATTRIBUTES( BOOST_MINSIZE )
+        constexpr void BOOST_CC_REG throw_if_error() BOOST_RESTRICTED_THIS PSI_ERR_NOEXCEPT_UNLESS_EXCEPTIONS
+        {
+            auto & self( this->self() );
+            if ( BOOST_LIKELY( self.succeeded() ) )
+            {
+                BOOST_ASSUME( self.inspected() );
+                return;
+            }
+            BOOST_ASSUME( self.inspected() );
+            self.throw_error();
+        }
+        BOOST_ATTRIBUTES( BOOST_MINSIZE )
+        constexpr void throw_if_uninspected_error() BOOST_RESTRICTED_THIS PSI_ERR_NOEXCEPT_UNLESS_EXCEPTIONS
+        {
+            auto & self( this->self() );
+            if ( !self.inspected() )
+            {
+                throw_if_error();
+                BOOST_ASSUME( self.succeeded() );
+            }
+            BOOST_ASSUME( self.inspected() );
+        }
+    BOOST_OPTIMIZE_FOR_SIZE_END()
+
+    private:
+        constexpr Derived       & self()       noexcept { return static_cast<Derived       &>( *this ); }
+        constexpr Derived const & self() const noexcept { return static_cast<Derived const &>( *this ); }
+
+        static constexpr bool nothrow_movable() noexcept { return noexcept( Derived( std::declval<Derived &&>() ) ); }
+    }; // class result_core
+} // namespace detail
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -62,13 +633,22 @@ bool constexpr compressed_result_error_variant
 /// \brief A discriminated union of a possible Result object or a possible
 /// Error object
 ///
+/// \detail All the specialisations (and fallible_result) are usable in
+/// constant expressions (for literal Results and Errors) - with the exception
+/// of throwing: a throw of the Error (e.g. throw_if_error() or a conversion of
+/// a failed fallible_result to the Result) during constant evaluation is a
+/// compile-time error. The usage (inspection) checks, including the implicit
+/// throw of an uninspected failure, are skipped there (see
+/// detail::unchecked_inspection()).
+/// With C++23 std::expected<Result, Error> converts to (a constructor) and
+/// from (an rvalue conversion operator) all the specialisations directly:
+/// with (at most) a single move of the Result or the Error and no checks
+/// beyond that of the source's own discriminator.
+///
 ////////////////////////////////////////////////////////////////////////////////
 
 template <class Result, class Error>
-class fallible_result;
-
-template <class Result, class Error>
-class [[ nodiscard, clang::trivial_abi ]] result_or_error
+class [[ nodiscard, clang::trivial_abi ]] result_or_error : public detail::result_core<result_or_error<Result, Error>>
 {
 public:
     /// \note Be liberal with the constructor argument type in order to allow
@@ -80,17 +660,42 @@ public:
     /// 'validity' check) i.e. don't assume succeeded_ = true if the 'from
     /// result' constructor is invoked.
     ///                                       (17.02.2016.) (Domagoj Saric)
-    // todo: variadic arguments
-    template <typename Source> requires std::is_constructible_v<Result, Source &&>                                result_or_error( Source && __restrict result ) noexcept( std::is_nothrow_constructible_v<Result, Source &&> ) : succeeded_( true  ), inspected_( false ), result_( std::forward<Source>( result ) ) {}
-    template <typename Source> requires std::is_constructible_v<Error , Source &&> BOOST_ATTRIBUTES( BOOST_COLD ) result_or_error( Source && __restrict error  ) noexcept( std::is_nothrow_constructible_v<Error , Source &&> ) : succeeded_( false ), inspected_( false ), error_ ( std::forward<Source>( error  ) ) {}
+    template <typename Source> requires detail::preferred_source<Source, Result, Error >                                constexpr result_or_error( Source && __restrict result ) noexcept( detail::is_nothrow_constructible_v<Result, Source &&> ) : succeeded_( true  ), inspected_( false ), result_( std::forward<Source>( result ) ) {}
+    template <typename Source> requires detail::preferred_source<Source, Error , Result> BOOST_ATTRIBUTES( BOOST_COLD ) constexpr result_or_error( Source && __restrict error, detail::call_site const site = {} ) noexcept( detail::is_nothrow_constructible_v<Error , Source &&> ) : succeeded_( false ), inspected_( false ), error_ ( std::forward<Source>( error  ) ) { detail::replace_no_error( error_ ); detail::record_failure( error_, site ); }
 
-    result_or_error( Result && result ) : succeeded_( true  ), inspected_( false ), result_( std::forward< Result >( result ) ) {}
-    result_or_error( Error  && error  ) : succeeded_( false ), inspected_( false ), error_ ( std::forward< Error  >( error  ) ) {}
+    /// In-place (variadic) construction of the Result (std::in_place) or the
+    /// Error (std::in_place_type<Error>).
+    template <typename ... Args> requires detail::is_constructible_v<Result, Args &&...>                                constexpr explicit result_or_error( std::in_place_t            , Args && ... args ) noexcept( detail::is_nothrow_constructible_v<Result, Args &&...> ) : succeeded_( true  ), inspected_( false ), result_( std::forward<Args>( args )... ) {}
+    template <typename ... Args> requires detail::is_constructible_v<Error , Args &&...> BOOST_ATTRIBUTES( BOOST_COLD ) constexpr explicit result_or_error( std::in_place_type_t<Error>, Args && ... args ) noexcept( detail::is_nothrow_constructible_v<Error , Args &&...> ) : succeeded_( false ), inspected_( false ), error_ ( std::forward<Args>( args )... ) { detail::replace_no_error( error_ ); detail::record_failure( error_, std::source_location{} ); }
+
+    constexpr result_or_error( Result && result ) : succeeded_( true  ), inspected_( false ), result_( std::forward< Result >( result ) ) {}
+    constexpr result_or_error( Error  && error, detail::call_site const site = {} ) : succeeded_( false ), inspected_( false ), error_ ( std::forward< Error  >( error  ) ) { detail::replace_no_error( error_ ); detail::record_failure( error_, site ); }
     result_or_error( result_or_error const & ) = delete;
 
+#if __cpp_lib_expected
+    constexpr result_or_error( std::expected<Result, Error> && source, detail::call_site const site = {} )
+        noexcept
+        (
+            detail::is_nothrow_move_constructible_v<Result> &&
+            detail::is_nothrow_move_constructible_v<Error >
+        )
+        : succeeded_( source.has_value() ), inspected_( false )
+    {
+        if ( BOOST_LIKELY( succeeded_ ) )
+            std::construct_at( &result_, std::move( *source ) );
+        else
+        {
+            std::construct_at( &error_, std::move( source ).error() );
+            detail::replace_no_error( error_ );
+            detail::record_failure( error_, site );
+        }
+    }
+#endif // __cpp_lib_expected
+
+    ~result_or_error() requires detail::trivially_destructible<Result, Error> = default;
 BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
     BOOST_ATTRIBUTES( BOOST_MINSIZE )
-    ~result_or_error() noexcept( std::is_nothrow_destructible_v<Result> && std::is_nothrow_destructible_v<Error> )
+    constexpr ~result_or_error() noexcept( std::is_nothrow_destructible_v<Result> && std::is_nothrow_destructible_v<Error> )
     {
         /// \note This assertion is too naive: multiple result_or_error
         /// instances have to be supported (and allow early function exist after
@@ -105,29 +710,16 @@ BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
         /// [[ nodiscard ]] to flag these/remaining cases.
         ///                                   (05.01.2016.) (Domagoj Saric)
         //BOOST_ASSERT_MSG( inspected(), "Ignored error return code." );
-        if ( BOOST_LIKELY( succeeded_ ) ) result_.~Result();
-        else                              error_ .~Error ();
+        if ( BOOST_LIKELY( succeeded_ ) ) std::destroy_at( &result_ );
+        else                              std::destroy_at( &error_  );
     };
 BOOST_OPTIMIZE_FOR_SIZE_END()
 
-    // See the note for propagate in fallible_result. For result_or_error the
-    // unexpected/buggy behaviour NRVO may manifest is:
-    //  - failure to get an assertion failure that you forgot to inspect the
-    //    state of the result before calling result() or error() getters
-    //  - throw_if_uninspected_error() might not throw when it should
-    result_or_error propagate() noexcept( std::is_nothrow_move_constructible_v<Result> ) { return std::move( *this ); }
-
-    fallible_result<Result, Error> as_fallible_result() noexcept( std::is_nothrow_move_constructible_v<Result> ) { return { std::move( *this ) }; }
-
-    Error  const & error () const noexcept { BOOST_ASSERT_MSG( inspected(), "Using a result_or_error w/o prior inspection" ); BOOST_ASSERT_MSG( !succeeded_, "Querying the error of a succeeded operation." ); return error_ ; }
-    Result       & result()       noexcept { BOOST_ASSERT_MSG( inspected(), "Using a result_or_error w/o prior inspection" ); BOOST_ASSERT_MSG(  succeeded_, "Querying the result of a failed operation."   ); return result_; }
-    Result const & result() const noexcept { return const_cast<result_or_error &>( *this ).result(); }
+    constexpr Error  const & error () const & noexcept { BOOST_ASSERT_MSG( inspected(), "Using a result_or_error w/o prior inspection" ); BOOST_ASSERT_MSG( !succeeded_, "Querying the error of a succeeded operation." ); return error_ ; }
+    constexpr Error       && error ()       && noexcept { return std::move( const_cast<Error &>( error() ) ); }
+    constexpr Result       & result()       noexcept { BOOST_ASSERT_MSG( inspected(), "Using a result_or_error w/o prior inspection" ); BOOST_ASSERT_MSG(  succeeded_, "Querying the result of a failed operation."   ); return result_; }
+    constexpr Result const & result() const noexcept { return const_cast<result_or_error &>( *this ).result(); }
 
-    Result       && operator *  ()       && noexcept { return std::move     ( result() ); }
-    Result       &  operator *  ()       &  noexcept { return                 result()  ; }
-    Result const &  operator *  () const &  noexcept { return                 result()  ; }
-    Result       *  operator -> ()          noexcept { return std::addressof( result() ); }
-    Result const *  operator -> () const    noexcept { return std::addressof( result() ); }
 
     /// \note Automatic to-Result conversion makes it too easy to forget to
     /// first inspect the returned value for success.
@@ -135,39 +727,23 @@ BOOST_OPTIMIZE_FOR_SIZE_END()
     //operator Result       & ()       noexcept { return result(); }
     //operator Result const & () const noexcept { return result(); }
 
-    [[ gnu::pure ]]   bool inspected() BOOST_RESTRICTED_THIS const noexcept {                    return BOOST_LIKELY( inspected_ ); }
-    [[ gnu::pure ]]   bool succeeded() BOOST_RESTRICTED_THIS const noexcept { inspected_ = true; return BOOST_LIKELY( succeeded_ ); }
-    explicit operator bool          () BOOST_RESTRICTED_THIS const noexcept {                    return succeeded()               ; }
+    [[ gnu::pure ]] constexpr bool inspected() BOOST_RESTRICTED_THIS const noexcept { return detail::unchecked_inspection() || BOOST_LIKELY( inspected_ ); }
+    [[ gnu::pure ]] constexpr bool succeeded() BOOST_RESTRICTED_THIS const noexcept { inspected_ = true; return BOOST_LIKELY( succeeded_ ); }
 
-    Result && assume_succeeded() && noexcept { BOOST_ASSUME( succeeded() ); return std::move( result() ); }
-
-BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
 
-    BOOST_ATTRIBUTES( BOOST_MINSIZE )
-    void BOOST_CC_REG throw_if_error() BOOST_RESTRICTED_THIS
-    {
-        //BOOST_ASSERT( !detail::uncaught_exceptions() );
-        if ( succeeded() )
-        {
-            BOOST_ASSUME( inspected_ );
-            BOOST_ASSUME( succeeded_ );
-            return;
-        }
-        BOOST_ASSUME( inspected_ );
-        throw_error();
-    }
-    BOOST_ATTRIBUTES( BOOST_MINSIZE )
-    void throw_if_uninspected_error() BOOST_RESTRICTED_THIS
+#if __cpp_lib_expected
+    constexpr operator std::expected<Result, Error>() && noexcept( detail::is_nothrow_move_constructible_v<std::expected<Result, Error>> )
     {
-        if ( !inspected() )
-        {
-            throw_if_error();
-            BOOST_ASSUME( succeeded_ );
-        }
-        BOOST_ASSUME( inspected_ );
+        if ( BOOST_LIKELY( succeeded() ) )
+            return std::expected<Result, Error>( std::in_place, std::move( result_ ) );
+        return std::expected<Result, Error>( std::unexpect, std::move( error_ ) );
     }
+#endif // __cpp_lib_expected
 
-    [[noreturn]] BOOST_ATTRIBUTES( BOOST_COLD )
+BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
+
+
+    [[noreturn]] PSI_RELEASE_FORCEINLINE
     void BOOST_CC_REG throw_error() BOOST_RESTRICTED_THIS
     {
         BOOST_ASSERT( !succeeded() );
@@ -175,25 +751,26 @@ BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
         // Workaround for an Apple Clang compilation error
         // (from the uber broken Xcode 10.2 update) - const_cast the effective
         // restrict qualifier from the error_ member.
-        make_and_throw_exception( std::move( const_cast< Error & >( error_ ) ) );
+        detail::throw_error( const_cast< Error & >( error_ ) );
     }
 
-    BOOST_ATTRIBUTES( BOOST_COLD )
+    PSI_RELEASE_FORCEINLINE
     std::exception_ptr BOOST_CC_REG make_exception_ptr() noexcept
     {
         // http://en.cppreference.com/w/cpp/error/exception_ptr
         BOOST_ASSERT( !succeeded() );
         BOOST_ASSERT( !detail::uncaught_exceptions() );
-        return make_exception_ptr( std::move( error_ ) );
+        return detail::error_exception_ptr( const_cast< Error & >( error_ ) );
     }
 BOOST_OPTIMIZE_FOR_SIZE_END()
 
 protected:
-    result_or_error( result_or_error && __restrict other )
+    result_or_error( result_or_error && ) requires detail::trivially_move_constructible<Result, Error> = default;
+    constexpr result_or_error( result_or_error && __restrict other )
         noexcept
         (
-            std::is_nothrow_move_constructible_v<Result> &&
-            std::is_nothrow_move_constructible_v<Error >
+            detail::is_nothrow_move_constructible_v<Result> &&
+            detail::is_nothrow_move_constructible_v<Error >
         )
         : succeeded_( other.succeeded() ), inspected_( false )
     {
@@ -202,25 +779,26 @@ protected:
         ///                                   (18.05.2015.) (Domagoj Saric)
         if ( BOOST_LIKELY( succeeded_ ) )
         {
-            auto * __restrict const ptr( new ( &result_ ) Result( std::move( other.result_ ) ) );
+            auto * __restrict const ptr( std::construct_at( &result_, std::move( other.result_ ) ) );
             BOOST_ASSUME( ptr              );
             BOOST_ASSUME( other.succeeded_ );
         }
         else
         {
-            auto * __restrict const ptr( new ( &error_  ) Error ( std::move( other.error_  ) ) );
+            auto * __restrict const ptr( std::construct_at( &error_ , std::move( other.error_  ) ) );
             BOOST_ASSUME( ptr               );
             BOOST_ASSUME( !other.succeeded_ );
         }
-        BOOST_ASSUME( this->inspected_ == false );
-        BOOST_ASSUME( other.inspected_ == true  );
+        BOOST_ASSUME( detail::unchecked_inspection() || !this->inspected_ );
+        BOOST_ASSUME( other.inspected() );
     }
 
 protected:
-            bool succeeded_;
-    mutable bool inspected_;
+            bool            succeeded_;
+    mutable bool            inspected_;
+    detail::pending_failure pending_{ detail::pending_failure::none }; // (fallible_result's)
 
-private: friend class fallible_result<Result, Error>;
+private: friend class fallible_result<Result, Error>; friend class detail::result_core<result_or_error>;
 #ifdef BOOST_MSVC
     #pragma warning( push )
     #pragma warning( disable : 4510 ) // Default constructor was implicitly defined as deleted.
@@ -247,100 +825,294 @@ private: friend class fallible_result<Result, Error>;
 
 template <class Result, class Error>
 requires compressed_result_error_variant<Result, Error>
-class [[ nodiscard, clang::trivial_abi ]] result_or_error<Result, Error>
+class [[ nodiscard, clang::trivial_abi ]] result_or_error<Result, Error> : public detail::result_core<result_or_error<Result, Error>>
 {
 public:
     template <typename Source>
-    result_or_error( Source && result ) noexcept( std::is_nothrow_constructible_v<Result, Source &&> )
+    requires( !std::is_same_v<std::remove_cvref_t<Source>, std::in_place_t> && !detail::is_fallible_result<std::remove_cvref_t<Source>> )
+    constexpr result_or_error( Source && result ) noexcept( detail::is_nothrow_constructible_v<Result, Source &&> )
         :
         result_{ std::forward<Source>( result ) }, inspected_{ false }
     {}
+    template <typename ... Args> requires detail::is_constructible_v<Result, Args &&...>
+    constexpr explicit result_or_error( std::in_place_t, Args && ... args ) noexcept( detail::is_nothrow_constructible_v<Result, Args &&...> )
+        :
+        result_( std::forward<Args>( args )... ), inspected_{ false }
+    {}
+#if __cpp_lib_expected
+    // (a failure is the default constructed, i.e. 'false', Result)
+    constexpr result_or_error( std::expected<Result, Error> && source ) noexcept( detail::is_nothrow_move_constructible_v<Result> && detail::is_nothrow_default_constructible_v<Result> )
+        :
+        result_( source.has_value() ? std::move( *source ) : Result() ), inspected_{ false }
+    {}
+#endif // __cpp_lib_expected
     result_or_error( result_or_error const & ) = delete;
 
 #if 0 // disabled
-    ~result_or_error() noexcept { BOOST_ASSERT_MSG( inspected(), "Ignored error return code." ); };
+    constexpr ~result_or_error() noexcept { BOOST_ASSERT_MSG( inspected(), "Ignored error return code." ); };
 #endif
 
-    result_or_error propagate() noexcept( std::is_nothrow_move_constructible_v<Result> ) { return std::move( *this ); }
-
-    fallible_result<Result, Error> as_fallible_result() noexcept( std::is_nothrow_move_constructible_v<Result> ) { return { std::move( *this ) }; }
-
-    Result       && operator *  ()       && noexcept { return std::move     ( result() ); }
-    Result       &  operator *  ()       &  noexcept { return                 result()  ; }
-    Result const &  operator *  () const &  noexcept { return                 result()  ; }
-    Result       *  operator -> ()          noexcept { return std::addressof( result() ); }
-    Result const *  operator -> () const    noexcept { return std::addressof( result() ); }
-
     BOOST_ATTRIBUTES( BOOST_COLD )
-    Error          error () const noexcept { BOOST_ASSERT_MSG( inspected() && !*this, "Querying the error of a (possibly) succeeded operation." ); return Error(); }
-    Result       & result()       noexcept { BOOST_ASSERT_MSG( inspected() &&  *this, "Querying the result of a (possibly) failed operation."   ); return result_; }
-    Result const & result() const noexcept { return const_cast<result_or_error &>( *this ).result(); }
+    constexpr Error          error () const noexcept { BOOST_ASSERT_MSG( inspected() && !*this, "Querying the error of a (possibly) succeeded operation." ); return Error(); }
+    constexpr Result       & result()       noexcept { BOOST_ASSERT_MSG( inspected() &&  *this, "Querying the result of a (possibly) failed operation."   ); return result_; }
+    constexpr Result const & result() const noexcept { return const_cast<result_or_error &>( *this ).result(); }
 
-    [[ gnu::pure ]]   bool inspected() const noexcept {                    return BOOST_LIKELY(                    inspected_ ); }
-    [[ gnu::pure ]]   bool succeeded() const noexcept { inspected_ = true; return BOOST_LIKELY( static_cast<bool>( result_ )  ); }
-    explicit operator bool          () const noexcept {                    return succeeded()                                  ; }
+    [[ gnu::pure ]] constexpr bool inspected() const noexcept { return detail::unchecked_inspection() || BOOST_LIKELY( inspected_ ); }
+    [[ gnu::pure ]] constexpr bool succeeded() const noexcept { inspected_ = true; return BOOST_LIKELY( static_cast<bool>( result_ )  ); }
 
-    Result && assume_succeeded() && noexcept { BOOST_ASSUME( succeeded() ); return std::move( result() ); }
 
-    BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
-#ifndef BOOST_NO_EXCEPTIONS //...mrmlj...kill this duplication with the unspecialized template...
-    BOOST_ATTRIBUTES( BOOST_MINSIZE )
-    void throw_if_error()
+#if __cpp_lib_expected
+    constexpr operator std::expected<Result, Error>() && noexcept( detail::is_nothrow_move_constructible_v<Result> )
     {
-        //BOOST_ASSERT( !detail::uncaught_exceptions() );
         if ( BOOST_LIKELY( succeeded() ) )
-        {
-            BOOST_ASSUME( inspected_ );
-            return;
-        }
-        BOOST_ASSUME( inspected_ );
-        throw_error();
+            return std::expected<Result, Error>( std::in_place, std::move( result_ ) );
+        return std::expected<Result, Error>( std::unexpect );
     }
+#endif // __cpp_lib_expected
 
-    void throw_if_uninspected_error() noexcept( false )
-    {
-        if ( !inspected() )
-            throw_if_error();
-        BOOST_ASSUME( inspected_ );
-    }
+    BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
 
-    BOOST_ATTRIBUTES( BOOST_COLD )
+
+    PSI_RELEASE_FORCEINLINE
     void throw_error()
     {
         BOOST_ASSERT( !succeeded() );
         //BOOST_ASSERT( !detail::uncaught_exceptions() );
-        detail::conditional_throw( error() );
+        detail::conditional_throw_error<Error>();
     }
-#endif // BOOST_NO_EXCEPTIONS
 
-    BOOST_ATTRIBUTES( BOOST_COLD )
+    PSI_RELEASE_FORCEINLINE
     std::exception_ptr BOOST_CC_REG make_exception_ptr()
     {
         BOOST_ASSERT( !succeeded() );
         BOOST_ASSERT( !detail::uncaught_exceptions() );
-        return make_exception_ptr( error() );
+        return detail::error_exception_ptr<Error>();
     }
     BOOST_OPTIMIZE_FOR_SIZE_END()
 
 protected:
-    result_or_error( result_or_error && __restrict other  ) noexcept( std::is_nothrow_move_constructible_v<Result> )
+    result_or_error( result_or_error && ) requires detail::is_trivially_move_constructible_v<Result> = default;
+    constexpr result_or_error( result_or_error && __restrict other  ) noexcept( detail::is_nothrow_move_constructible_v<Result> )
         :
         result_   { std::move( other.result_ ) },
         inspected_{ false                      }
     {
         other.inspected_ = true;
-        BOOST_ASSUME( this->inspected_ == false );
-        BOOST_ASSUME( other.inspected_ == true  );
+        BOOST_ASSUME( detail::unchecked_inspection() || !this->inspected_ );
+        BOOST_ASSUME( other.inspected() );
     }
 
-private: friend class fallible_result<Result, Error>;
+private: friend class fallible_result<Result, Error>; friend class detail::result_core<result_or_error>;
     Result result_;
 
 protected:
-    mutable bool inspected_;
+    mutable bool            inspected_;
+    detail::pending_failure pending_{ detail::pending_failure::none }; // (fallible_result's)
 }; // class result_or_error 'compressed' specialisation
 
 
+////////////////////////////////////////////////////////////////////////////////
+///
+/// 'niche' result_or_error specialisation for Results with a niche_traits
+/// specialisation (i.e. with an 'invalid' value) and stateless (empty or
+/// is_stateless_error) default-constructible Errors.
+///
+/// \detail The object holds only the Result (set to the invalid value on
+/// failure) - the Error is not stored but (re)created on demand, i.e. for
+/// Errors that (re)read the thread's 'last error' a failed result has to be
+/// inspected before anything else can clobber that state.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Result, class Error>
+requires niche_result_error_variant<Result, Error>
+class [[ nodiscard, clang::trivial_abi ]] result_or_error<Result, Error> : public detail::result_core<result_or_error<Result, Error>>
+{
+public:
+    template <typename Source> requires detail::preferred_source<Source, Result, Error >                                constexpr result_or_error( Source && __restrict result ) noexcept( detail::is_nothrow_constructible_v<Result, Source &&> ) : result_( std::forward<Source>( result ) ), inspected_( false ) {}
+    template <typename Source> requires detail::preferred_source<Source, Error , Result> BOOST_ATTRIBUTES( BOOST_COLD ) constexpr result_or_error( [[ maybe_unused ]] Source && error, [[ maybe_unused ]] detail::call_site const site = {} ) noexcept : result_( niche_traits<Result>::invalid() ), inspected_( false )
+    {
+    #if PSI_ERR_ERROR_STATISTICS
+        detail::record_failure( Error( std::forward<Source>( error ) ), site );
+    #endif // PSI_ERR_ERROR_STATISTICS
+    }
+
+    template <typename ... Args> requires detail::is_constructible_v<Result, Args &&...>                                constexpr explicit result_or_error( std::in_place_t            , Args && ... args ) noexcept( detail::is_nothrow_constructible_v<Result, Args &&...> ) : result_( std::forward<Args>( args )... ), inspected_( false ) {}
+    template <typename ... Args> requires detail::is_constructible_v<Error , Args &&...> BOOST_ATTRIBUTES( BOOST_COLD ) constexpr explicit result_or_error( std::in_place_type_t<Error>, Args && ...      ) noexcept                                                      : result_( niche_traits<Result>::invalid() ), inspected_( false ) { detail::record_failure( Error(), std::source_location{} ); }
+
+    constexpr result_or_error( Result && result ) noexcept( detail::is_nothrow_move_constructible_v<Result> ) : result_( std::forward< Result >( result ) ), inspected_( false ) {}
+    constexpr result_or_error( Error  && error, [[ maybe_unused ]] detail::call_site const site = {} ) noexcept : result_( niche_traits<Result>::invalid() ), inspected_( false ) { detail::record_failure( error, site ); }
+    result_or_error( result_or_error const & ) = delete;
+
+#if __cpp_lib_expected
+    // (the Error of a failure is dropped - see above)
+    constexpr result_or_error( std::expected<Result, Error> && source, [[ maybe_unused ]] detail::call_site const site = {} ) noexcept( detail::is_nothrow_move_constructible_v<Result> )
+        : result_( source.has_value() ? std::move( *source ) : Result( niche_traits<Result>::invalid() ) ), inspected_( false )
+    {
+        if ( !source.has_value() )
+            detail::record_failure( source.error(), site );
+    }
+#endif // __cpp_lib_expected
+
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    constexpr Error          error () const noexcept( detail::is_nothrow_default_constructible_v<Error> ) { BOOST_ASSERT_MSG( inspected() && !holds_result(), "Querying the error of a (possibly) succeeded operation." ); return Error(); }
+    constexpr Result       & result()       noexcept                                                   { BOOST_ASSERT_MSG( inspected() &&  holds_result(), "Querying the result of a (possibly) failed operation."   ); return result_; }
+    constexpr Result const & result() const noexcept                                                   { return const_cast<result_or_error &>( *this ).result(); }
+
+    [[ gnu::pure ]] constexpr bool inspected() const noexcept { return detail::unchecked_inspection() || BOOST_LIKELY( inspected_ ); }
+    [[ gnu::pure ]] constexpr bool succeeded() const noexcept { inspected_ = true; return BOOST_LIKELY( holds_result() ); }
+
+
+#if __cpp_lib_expected
+    constexpr operator std::expected<Result, Error>() && noexcept( detail::is_nothrow_move_constructible_v<Result> && detail::is_nothrow_default_constructible_v<Error> )
+    {
+        if ( BOOST_LIKELY( succeeded() ) )
+            return std::expected<Result, Error>( std::in_place, std::move( result_ ) );
+        return std::expected<Result, Error>( std::unexpect ); // (the recreated Error)
+    }
+#endif // __cpp_lib_expected
+
+BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
+
+
+    [[ noreturn ]] PSI_RELEASE_FORCEINLINE
+    void throw_error()
+    {
+        BOOST_ASSERT( !succeeded() );
+        detail::throw_error<Error>();
+    }
+
+    PSI_RELEASE_FORCEINLINE
+    std::exception_ptr BOOST_CC_REG make_exception_ptr()
+    {
+        BOOST_ASSERT( !succeeded() );
+        BOOST_ASSERT( !detail::uncaught_exceptions() );
+        return detail::error_exception_ptr<Error>();
+    }
+BOOST_OPTIMIZE_FOR_SIZE_END()
+
+protected:
+    result_or_error( result_or_error && ) requires detail::is_trivially_move_constructible_v<Result> = default;
+    constexpr result_or_error( result_or_error && __restrict other ) noexcept( detail::is_nothrow_move_constructible_v<Result> )
+        :
+        result_   ( std::move( other.result_ ) ),
+        inspected_( false                      )
+    {
+        other.inspected_ = true;
+        BOOST_ASSUME( detail::unchecked_inspection() || !this->inspected_ );
+        BOOST_ASSUME( other.inspected() );
+    }
+
+private:
+    constexpr bool holds_result() const noexcept { return detail::niche_is_valid( result_ ); }
+
+private: friend class fallible_result<Result, Error>; friend class detail::result_core<result_or_error>;
+    Result result_;
+
+protected:
+    mutable bool            inspected_;
+    detail::pending_failure pending_{ detail::pending_failure::none }; // (fallible_result's)
+}; // class result_or_error 'niche' specialisation
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// 'sentinel-packed' result_or_error specialisation for:
+/// - trivial Results AND
+/// - Errors with a sentinel_traits specialisation (e.g. last_errno,
+///   last_win32_error)
+/// where storing both side by side does not make the object larger.
+///
+/// \detail Both the Result and the Error are always live, success is signaled
+/// by the Error holding its no_error value so there is no separate
+/// discriminator and no branching on move/destruction (failures are
+/// never constructed with a no_error value - see sentinel_traits).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Result, class Error>
+requires sentinel_result_error_variant<Result, Error>
+class [[ nodiscard, clang::trivial_abi ]] result_or_error<Result, Error> : public detail::result_core<result_or_error<Result, Error>>
+{
+public:
+    template <typename Source> requires detail::preferred_source<Source, Result, Error >                                constexpr result_or_error( Source && __restrict result ) noexcept( detail::is_nothrow_constructible_v<Result, Source &&> ) : result_( std::forward<Source>( result ) ), error_{ Error::no_error }           , inspected_( false ) {}
+    template <typename Source> requires detail::preferred_source<Source, Error , Result> BOOST_ATTRIBUTES( BOOST_COLD ) constexpr result_or_error( Source && __restrict error, detail::call_site const site = {} ) noexcept( detail::is_nothrow_constructible_v<Error , Source &&> ) : result_{}                               , error_( std::forward<Source>( error ) ), inspected_( false ) { detail::replace_no_error( error_ ); detail::record_failure( error_, site ); }
+
+    template <typename ... Args> requires detail::is_constructible_v<Result, Args &&...>                                constexpr explicit result_or_error( std::in_place_t            , Args && ... args ) noexcept( detail::is_nothrow_constructible_v<Result, Args &&...> ) : result_( std::forward<Args>( args )... ), error_{ Error::no_error }             , inspected_( false ) {}
+    template <typename ... Args> requires detail::is_constructible_v<Error , Args &&...> BOOST_ATTRIBUTES( BOOST_COLD ) constexpr explicit result_or_error( std::in_place_type_t<Error>, Args && ... args ) noexcept( detail::is_nothrow_constructible_v<Error , Args &&...> ) : result_{}                              , error_( std::forward<Args>( args )... ), inspected_( false ) { detail::replace_no_error( error_ ); detail::record_failure( error_, std::source_location{} ); }
+
+    constexpr result_or_error( Result && result ) noexcept : result_( std::forward< Result >( result ) ), error_{ Error::no_error }              , inspected_( false ) {}
+    constexpr result_or_error( Error  && error, detail::call_site const site = {} ) noexcept : result_{}, error_( std::forward< Error >( error ) ), inspected_( false ) { detail::replace_no_error( error_ ); detail::record_failure( error_, site ); }
+    result_or_error( result_or_error const & ) = delete;
+
+#if __cpp_lib_expected
+    constexpr result_or_error( std::expected<Result, Error> && source, detail::call_site const site = {} ) noexcept
+        :
+        result_   ( source.has_value() ? *source                    : Result{}                  ),
+        error_    ( source.has_value() ? Error{ Error::no_error }   : std::move( source ).error() ),
+        inspected_( false )
+    {
+        if ( !source.has_value() )
+        {
+            detail::replace_no_error( error_ );
+            detail::record_failure( error_, site );
+        }
+    }
+#endif // __cpp_lib_expected
+
+    constexpr Error  const & error () const & noexcept { BOOST_ASSERT_MSG( inspected(), "Using a result_or_error w/o prior inspection" ); BOOST_ASSERT_MSG( !holds_result(), "Querying the error of a succeeded operation." ); return error_ ; }
+    constexpr Error       && error ()       && noexcept { return std::move( const_cast<Error &>( error() ) ); }
+    constexpr Result       & result()       noexcept { BOOST_ASSERT_MSG( inspected(), "Using a result_or_error w/o prior inspection" ); BOOST_ASSERT_MSG(  holds_result(), "Querying the result of a failed operation."   ); return result_; }
+    constexpr Result const & result() const noexcept { return const_cast<result_or_error &>( *this ).result(); }
+
+
+    [[ gnu::pure ]] constexpr bool inspected() BOOST_RESTRICTED_THIS const noexcept { return detail::unchecked_inspection() || BOOST_LIKELY( inspected_ ); }
+    [[ gnu::pure ]] constexpr bool succeeded() BOOST_RESTRICTED_THIS const noexcept { inspected_ = true; return BOOST_LIKELY( holds_result() ); }
+
+
+#if __cpp_lib_expected
+    constexpr operator std::expected<Result, Error>() && noexcept
+    {
+        if ( BOOST_LIKELY( succeeded() ) )
+            return std::expected<Result, Error>( std::in_place, result_ );
+        return std::expected<Result, Error>( std::unexpect, error_ );
+    }
+#endif // __cpp_lib_expected
+
+BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
+
+    [[noreturn]] PSI_RELEASE_FORCEINLINE
+    void BOOST_CC_REG throw_error() BOOST_RESTRICTED_THIS
+    {
+        BOOST_ASSERT( !succeeded() );
+        detail::throw_error( const_cast< Error & >( error_ ) );
+    }
+
+    PSI_RELEASE_FORCEINLINE
+    std::exception_ptr BOOST_CC_REG make_exception_ptr() noexcept
+    {
+        BOOST_ASSERT( !succeeded() );
+        BOOST_ASSERT( !detail::uncaught_exceptions() );
+        return detail::error_exception_ptr( const_cast< Error & >( error_ ) );
+    }
+BOOST_OPTIMIZE_FOR_SIZE_END()
+
+protected:
+    result_or_error( result_or_error && ) noexcept = default;
+
+private:
+    constexpr bool holds_result() const noexcept { return detail::sentinel_is_success( error_ ); }
+
+private: friend class fallible_result<Result, Error>; friend class detail::result_core<result_or_error>;
+    Result result_;
+    Error  error_ ;
+
+protected:
+    mutable bool            inspected_;
+    detail::pending_failure pending_{ detail::pending_failure::none }; // (fallible_result's)
+}; // class result_or_error 'sentinel-packed' specialisation
+
+
 ////////////////////////////////////////////////////////////////////////////////
 ///
 /// result_or_error<void, Error> specialization for void-return functions.
@@ -351,21 +1123,47 @@ template <class Error>
 using void_or_error = result_or_error<void, Error>;
 
 template <class Error>
-class [[ nodiscard, clang::trivial_abi ]] result_or_error<void, Error>
+class [[ nodiscard, clang::trivial_abi ]] result_or_error<void, Error> : public detail::result_core<result_or_error<void, Error>>
 {
 public:
     template <typename Source>
-    requires( !std::is_same_v<Source, fallible_result<void, Error>> )
+    requires( !std::is_same_v<Source, fallible_result<void, Error>> && !std::is_same_v<std::remove_cvref_t<Source>, std::in_place_type_t<Error>> )
     BOOST_ATTRIBUTES( BOOST_COLD )
-    result_or_error( Source && __restrict error )
-        noexcept( std::is_nothrow_constructible_v<Error, Source &&> )
+    constexpr result_or_error( Source && __restrict error, detail::call_site const site = {} )
+        noexcept( detail::is_nothrow_constructible_v<Error, Source &&> )
         : 
         error_{ std::forward<Source>( error ) }, succeeded_{ false }, inspected_{ false } 
-    {}
-    result_or_error( no_err_t ) noexcept : succeeded_{ true }, inspected_{ false } {}
+    {
+        detail::replace_no_error( error_ );
+        detail::record_failure( error_, site );
+    }
+    template <typename ... Args> requires detail::is_constructible_v<Error, Args &&...>
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    constexpr explicit result_or_error( std::in_place_type_t<Error>, Args && ... args )
+        noexcept( detail::is_nothrow_constructible_v<Error, Args &&...> )
+        :
+        error_( std::forward<Args>( args )... ), succeeded_{ false }, inspected_{ false }
+    {
+        detail::replace_no_error( error_ );
+        detail::record_failure( error_, std::source_location{} );
+    }
+    constexpr result_or_error( no_err_t ) noexcept : succeeded_{ true }, inspected_{ false } {}
+#if __cpp_lib_expected
+    constexpr result_or_error( std::expected<void, Error> && source, detail::call_site const site = {} ) noexcept( detail::is_nothrow_move_constructible_v<Error> )
+        : succeeded_{ source.has_value() }, inspected_{ false }
+    {
+        if ( !succeeded_ ) [[ unlikely ]]
+        {
+            std::construct_at( &error_, std::move( source ).error() );
+            detail::replace_no_error( error_ );
+            detail::record_failure( error_, site );
+        }
+    }
+#endif // __cpp_lib_expected
     result_or_error( result_or_error const & ) = delete;
+    ~result_or_error() requires detail::is_trivially_destructible_v<Error> = default;
     BOOST_ATTRIBUTES( BOOST_MINSIZE )
-    ~result_or_error() noexcept( std::is_nothrow_destructible_v<Error> )
+    constexpr ~result_or_error() noexcept( std::is_nothrow_destructible_v<Error> )
     {
         /** @note
          * See above implementation note for generic version.
@@ -373,75 +1171,63 @@ public:
          */
         // BOOST_ASSERT_MSG( inspected(), "Ignored (error) return value." );
         if ( !succeeded_ ) [[ unlikely ]]
-            error_.~Error();
+            std::destroy_at( &error_ );
     };
 
-    result_or_error              propagate         () noexcept( std::is_nothrow_move_constructible_v<Error> ) { return   std::move( *this )  ; }
-    fallible_result<void, Error> as_fallible_result() noexcept( std::is_nothrow_move_constructible_v<Error> ) { return { std::move( *this ) }; }
 
     BOOST_ATTRIBUTES( BOOST_COLD )
-    Error const & error() const noexcept { BOOST_ASSERT_MSG( inspected() && !*this, "Querying the error of a (possibly) succeeded operation." ); return error_; }
+    constexpr Error const & error() const & noexcept { BOOST_ASSERT_MSG( inspected() && !*this, "Querying the error of a (possibly) succeeded operation." ); return error_; }
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    constexpr Error      && error()       && noexcept { return std::move( const_cast<Error &>( error() ) ); }
 
-    [[ gnu::pure ]]   bool inspected() const noexcept {                    return BOOST_LIKELY( inspected_ ); }
-    [[ gnu::pure ]]   bool succeeded() const noexcept { inspected_ = true; return BOOST_LIKELY( succeeded_ ); }
-    explicit operator bool          () const noexcept {                    return succeeded()               ; }
+    [[ gnu::pure ]] constexpr bool inspected() const noexcept { return detail::unchecked_inspection() || BOOST_LIKELY( inspected_ ); }
+    [[ gnu::pure ]] constexpr bool succeeded() const noexcept { inspected_ = true; return BOOST_LIKELY( succeeded_ ); }
 
-    void assume_succeeded() && noexcept { BOOST_ASSUME( succeeded() ); }
 
-BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
-#ifndef BOOST_NO_EXCEPTIONS //...mrmlj...kill this duplication...
-    BOOST_ATTRIBUTES( BOOST_MINSIZE )
-    void throw_if_error()
+#if __cpp_lib_expected
+    constexpr operator std::expected<void, Error>() && noexcept( detail::is_nothrow_move_constructible_v<Error> )
     {
-        BOOST_ASSERT( !detail::uncaught_exceptions() );
         if ( BOOST_LIKELY( succeeded() ) )
-        {
-            BOOST_ASSUME( inspected_ );
-            return;
-        }
-        BOOST_ASSUME( inspected_ );
-        throw_error();
+            return std::expected<void, Error>();
+        return std::expected<void, Error>( std::unexpect, std::move( error_ ) );
     }
+#endif // __cpp_lib_expected
+
+BOOST_OPTIMIZE_FOR_SIZE_BEGIN()
 
-    void throw_if_uninspected_error() noexcept( false )
-    {
-        if ( !inspected() )
-            throw_if_error();
-        BOOST_ASSUME( inspected_ );
-    }
 
-    [[ noreturn ]] BOOST_ATTRIBUTES( BOOST_COLD )
-    void throw_error() noexcept( false )
+    [[ noreturn ]] PSI_RELEASE_FORCEINLINE
+    void throw_error() PSI_ERR_NOEXCEPT_UNLESS_EXCEPTIONS
     {
         BOOST_ASSERT( !succeeded() );
         BOOST_ASSERT( !detail::uncaught_exceptions() );
-        make_and_throw_exception( error() );
+        detail::throw_error( error_ );
     }
-#endif // BOOST_NO_EXCEPTIONS
 
-    BOOST_ATTRIBUTES( BOOST_COLD )
+    PSI_RELEASE_FORCEINLINE
     std::exception_ptr BOOST_CC_REG make_exception_ptr()
     {
         BOOST_ASSERT( !succeeded() );
         BOOST_ASSERT( !detail::uncaught_exceptions() );
-        return make_exception_ptr( error() );
+        return detail::error_exception_ptr( error_ );
     }
 BOOST_OPTIMIZE_FOR_SIZE_END()
 
 protected:
-    result_or_error( result_or_error && __restrict other ) noexcept( std::is_nothrow_move_constructible_v<Error> )
+    result_or_error( result_or_error && ) requires detail::is_trivially_move_constructible_v<Error> = default;
+    constexpr result_or_error( result_or_error && __restrict other ) noexcept( detail::is_nothrow_move_constructible_v<Error> )
         : succeeded_( other.succeeded() ), inspected_( false )
     {
         if ( !succeeded_ ) [[ unlikely ]]
         {
-            auto const ptr( new ( &error_ ) Error ( std::move( other.error_ ) ) );
+            auto const ptr( std::construct_at( &error_, std::move( other.error_ ) ) );
             BOOST_ASSUME( ptr );
             BOOST_ASSUME( !other.succeeded_ );
         }
-        BOOST_ASSUME( other.inspected_ );
+        BOOST_ASSUME( other.inspected() );
     }
 
-private: friend class fallible_result<void, Error>;
+private: friend class fallible_result<void, Error>; friend class detail::result_core<result_or_error>;
 #ifdef BOOST_MSVC
     #pragma warning( push )
     #pragma warning( disable : 4510 ) // Default constructor was implicitly defined as deleted.
@@ -453,21 +1239,80 @@ private: friend class fallible_result<void, Error>;
 #endif // BOOST_MSVC
 
 protected:
-            bool const succeeded_;
-    mutable bool       inspected_;
+            bool const      succeeded_;
+    mutable bool            inspected_;
+    detail::pending_failure pending_{ detail::pending_failure::none }; // (fallible_result's)
 }; // class result_or_error 'void result' specialisation
 
 
-template <typename Result, typename Error> bool operator==( result_or_error<Result, Error> const & result, no_err_t ) noexcept { return  result.succeeded(); }
-template <typename Result, typename Error> bool operator==( result_or_error<Result, Error> const & result, an_err_t ) noexcept { return !result.succeeded(); }
-template <typename Result, typename Error> bool operator!=( result_or_error<Result, Error> const & result, no_err_t ) noexcept { return !result.succeeded(); }
-template <typename Result, typename Error> bool operator!=( result_or_error<Result, Error> const & result, an_err_t ) noexcept { return  result.succeeded(); }
+namespace detail
+{
+    template <class Result, class Error>
+    struct result_traits<result_or_error<Result, Error>>
+    {
+        using result = Result;
+        using error  = Error ;
+
+        template <class Chained>
+        using rebind = Chained;
+
+        static constexpr result_or_error<Result, Error> & source( result_or_error<Result, Error> & self ) noexcept { return self; }
+    }; // struct result_traits<result_or_error>
+} // namespace detail
+
+namespace detail
+{
+    // Normalises (saved) result objects to the underlying result_or_error
+    // (see the fallible_result overloads in fallible_result.hpp).
+    template <class Result, class Error>
+    constexpr result_or_error<Result, Error> & try_target( result_or_error<Result, Error> & result ) noexcept { return result; }
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Early-return error propagation
+/// ------------------------------
+///
+/// The expression (returning a result_or_error or a fallible_result) is bound
+/// to a reference (no copy or move of the returned object) and in case of
+/// failure its Error is moved directly into the return value of the enclosing
+/// function (which has to return a result_or_error or fallible_result with a
+/// compatible Error type).
+/// - PSI_ERR_PROPAGATE_FAILURE( expression ): discards the Result
+/// - PSI_ERR_SAVE_RESULT_OR_PROPAGATE_FAILURE( name, expression ): declares
+///   name as a reference to the (inspected and succeeded) result_or_error
+/// - PSI_ERR_TRY( expression ): (GCC and Clang only - uses statement
+///   expressions) evaluates to the Result (prvalue), e.g.
+///   auto const size{ PSI_ERR_TRY( file.size() ) };
+///
+/// \note These bypass the need for propagate() (and its additional move).
+///
+////////////////////////////////////////////////////////////////////////////////
 
 #define PSI_ERR_PROPAGATE_FAILURE( expression ) \
-    { auto const result( expression ); if ( !result ) result.error(); }
+    { \
+        auto && psi_err_propagate_source( expression ); \
+        auto &  psi_err_propagate_result( ::psi::err::detail::try_target( psi_err_propagate_source ) ); \
+        if ( !psi_err_propagate_result.succeeded() ) [[ unlikely ]] \
+            return std::move( psi_err_propagate_result ).error(); \
+    }
 
 #define PSI_ERR_SAVE_RESULT_OR_PROPAGATE_FAILURE( result, expression ) \
-    auto result( expression ); if ( !result ) result.error();
+    auto && result##_psi_err_source( expression ); \
+    auto &  result( ::psi::err::detail::try_target( result##_psi_err_source ) ); \
+    if ( !result.succeeded() ) [[ unlikely ]] \
+        return std::move( result ).error();
+
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define PSI_ERR_TRY( ... ) \
+    ( { \
+        auto && psi_err_try_source( __VA_ARGS__ ); \
+        auto &  psi_err_try_result( ::psi::err::detail::try_target( psi_err_try_source ) ); \
+        if ( !psi_err_try_result.succeeded() ) [[ unlikely ]] \
+            return std::move( psi_err_try_result ).error(); \
+        std::move( psi_err_try_result ).assume_succeeded(); \
+    } )
+#endif // __GNUC__ || __clang__
 
 //------------------------------------------------------------------------------
 } // namespace psi::err
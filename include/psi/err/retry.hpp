@@ -0,0 +1,228 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file retry.hpp
+/// ---------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "fallible_result.hpp"
+#include "result_or_error.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#include <intrin.h>
+#endif
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Retrying transient failures
+/// ---------------------------
+///
+/// \brief retry<Policy>( f ) calls f (returning a result_or_error<T, E> or a
+/// fallible_result<T, E>) until it succeeds, fails with a non-transient Error
+/// or the attempt/deadline budget of the Policy runs out and returns the
+/// outcome of the last attempt as a fallible_result<T, E>.
+///
+/// \detail A Policy classifies Errors (classify( Error const & ) ->
+/// retry_kind) and provides the backoff_options: 'immediate' failures (e.g.
+/// EINTR) are simply retried, 'backoff' ones (e.g. EAGAIN) escalate from
+/// immediate retries (spins), over exponentially growing CPU pause loops and
+/// std::this_thread::yield()s, to exponentially growing sleeps (capped by the
+/// time left until the deadline). The deadline is measured from the first
+/// failure (the success path never reads the clock).
+/// Usage:
+///     auto bytes{ retry<errno_retry>( [ & ] { return read( fd, buffer ); } ) };
+///     auto done { retry<retry_on<last_win32_error, ERROR_IO_PENDING>>( [ & ] { return poll_completion( overlapped ); } ) };
+///
+////////////////////////////////////////////////////////////////////////////////
+
+enum struct retry_kind : std::uint8_t
+{
+    fail,
+    immediate, ///< retry right away (an interrupted call)
+    backoff    ///< retry after the next backoff step (a busy resource)
+}; // enum struct retry_kind
+
+struct backoff_options
+{
+    using duration = std::chrono::steady_clock::duration;
+
+    std::uint32_t max_attempts{ 64 }; ///< including the first call (0 - unlimited)
+    duration      deadline    { std::chrono::milliseconds( 100 ) }; ///< zero - none
+    std::uint16_t spins       { 2  }; ///< immediate retries of 'backoff' failures
+    std::uint16_t pauses      { 8  }; ///< pause loop steps (of 2, 4, 8... CPU pause instructions)
+    std::uint16_t yields      { 4  }; ///< std::this_thread::yield() steps
+    duration      min_sleep   { std::chrono::microseconds( 20 ) }; ///< the first (doubled at every following step) sleep
+    duration      max_sleep   { std::chrono::milliseconds( 5 ) };
+}; // struct backoff_options
+
+namespace detail
+{
+    // Errors are classified by the value captured in the Error object (the
+    // thread-local error state may have been overwritten by the time of the
+    // classification) - falling back to Error::is<value>() for Errors without
+    // a value.
+    template <auto value, class Error>
+    constexpr bool error_is( Error const & error ) noexcept
+    {
+        if constexpr ( requires { static_cast<typename Error::value_type>( error ); } )
+            return static_cast<typename Error::value_type>( error ) == value;
+        else
+            return Error::template is<value>();
+    }
+
+    PSI_RELEASE_FORCEINLINE
+    void cpu_relax() noexcept
+    {
+    #if defined( __i386__ ) || defined( __x86_64__ )
+        __builtin_ia32_pause();
+    #elif defined( __aarch64__ ) || defined( __arm__ )
+        __asm__ __volatile__( "yield" );
+    #elif defined( _M_IX86 ) || defined( _M_X64 )
+        _mm_pause();
+    #elif defined( _M_ARM64 ) || defined( _M_ARM )
+        __yield();
+    #endif
+    }
+
+    class backoff
+    {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        explicit backoff( backoff_options const & options ) noexcept : options_( options ) {}
+
+        /// Waits for the next retry - false if the deadline has run out.
+        BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+        bool wait() noexcept
+        {
+            auto step( step_++ );
+            if ( step < options_.spins )
+                return true;
+            step -= options_.spins;
+
+            auto left( clock::duration::max() );
+            if ( options_.deadline != clock::duration::zero() )
+            {
+                auto const now( clock::now() );
+                if ( deadline_ == clock::time_point{} )
+                    deadline_ = now + options_.deadline;
+                if ( now >= deadline_ )
+                    return false;
+                left = deadline_ - now;
+            }
+
+            if ( step < options_.pauses )
+            {
+                for ( auto pause{ 2U << std::min( step, 10U ) }; pause; --pause )
+                    cpu_relax();
+                return true;
+            }
+            step -= options_.pauses;
+
+            if ( step < options_.yields )
+            {
+                std::this_thread::yield();
+                return true;
+            }
+            step -= options_.yields;
+
+            auto const sleep( std::min( options_.min_sleep * ( std::int64_t{ 1 } << std::min( step, 20U ) ), options_.max_sleep ) );
+            std::this_thread::sleep_for( std::min( sleep, left ) );
+            return true;
+        }
+
+    private:
+        backoff_options const & options_;
+        std::uint32_t           step_{ 0 };
+        clock::time_point       deadline_{};
+    }; // class backoff
+} // namespace detail
+
+
+/// Retries (with backoff) failures with any of the listed Error values.
+template <class Error, auto ... transient>
+struct retry_on : backoff_options
+{
+    static constexpr retry_kind classify( Error const & error ) noexcept
+    {
+        return ( detail::error_is<transient>( error ) || ... ) ? retry_kind::backoff : retry_kind::fail;
+    }
+}; // struct retry_on
+
+/// The usual syscall wrapper policy (for last_errno and errno_code): EINTR is
+/// retried immediately, EAGAIN/EWOULDBLOCK with backoff.
+struct errno_retry : backoff_options
+{
+    template <class Error>
+    static constexpr retry_kind classify( Error const & error ) noexcept
+    {
+        if ( detail::error_is<EINTR>( error ) )
+            return retry_kind::immediate;
+        if ( detail::error_is<EAGAIN>( error ) || detail::error_is<EWOULDBLOCK>( error ) )
+            return retry_kind::backoff;
+        return retry_kind::fail;
+    }
+}; // struct errno_retry
+
+
+template <class Policy, typename F>
+auto retry( F && f, Policy const & policy = Policy{} )
+{
+    using outcome = std::remove_cvref_t<std::invoke_result_t<F &>>;
+    using result  = typename detail::result_traits<outcome>::result;
+    using error   = typename detail::result_traits<outcome>::error ;
+    using target  = fallible_result<result, error>;
+    static_assert( std::is_same_v<decltype( policy.classify( std::declval<error const &>() ) ), retry_kind>, "The retry Policy has to classify the Errors of the callable." );
+
+    detail::backoff backoff( policy );
+    for ( std::uint32_t attempt{ 1 }; ; ++attempt )
+    {
+        auto   attempted{ std::invoke( f ) };
+        auto & source( detail::result_traits<outcome>::source( attempted ) );
+        if ( source.succeeded() ) [[ likely ]]
+        {
+            if constexpr ( std::is_void_v<result> ) { std::move( source ).assume_succeeded(); return detail::make_succeeded<target>(); }
+            else                                      return detail::make_succeeded<target>( std::move( source ).assume_succeeded() );
+        }
+
+        auto const kind( policy.classify( source.error() ) );
+        if
+        (
+            kind == retry_kind::fail                           ||
+            attempt == policy.max_attempts                     ||
+            ( kind == retry_kind::backoff && !backoff.wait() )
+        )
+            return detail::make_failed<target>( std::move( source ).error() );
+    }
+}
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
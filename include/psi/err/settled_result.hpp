@@ -0,0 +1,262 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file settled_result.hpp
+/// ------------------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "fallible_result.hpp"
+#include "result_or_error.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \struct is_trivially_relocatable
+///
+/// \brief (P1144 style) opt-in trait for types whose move construction
+/// followed by the destruction of the source is equivalent to a memcpy.
+///
+/// \detail Defaults to std::is_trivially_copyable (or Clang's builtin, which
+/// also accounts for clang::trivial_abi types). Specialise (to true_type) for
+/// your own types, e.g. ones holding only a (non self-referencing) pointer.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined( __has_builtin )
+#if __has_builtin( __is_trivially_relocatable )
+#   define PSI_ERR_IS_TRIVIALLY_RELOCATABLE( T ) __is_trivially_relocatable( T )
+#endif
+#endif
+#ifndef PSI_ERR_IS_TRIVIALLY_RELOCATABLE
+#   define PSI_ERR_IS_TRIVIALLY_RELOCATABLE( T ) std::is_trivially_copyable_v<T>
+#endif // PSI_ERR_IS_TRIVIALLY_RELOCATABLE
+
+template <class T>
+struct is_trivially_relocatable : std::bool_constant<PSI_ERR_IS_TRIVIALLY_RELOCATABLE( T )> {};
+
+template <class T>
+bool constexpr is_trivially_relocatable_v{ is_trivially_relocatable<T>::value };
+
+
+template <class Result, class Error>
+class settled_result;
+
+namespace detail
+{
+    template <class Result, class Error>
+    bool constexpr settled_trivially_copyable
+    {
+        std::is_trivially_copy_constructible_v<Result> && std::is_trivially_copy_constructible_v<Error> &&
+        std::is_trivially_move_constructible_v<Result> && std::is_trivially_move_constructible_v<Error> &&
+        std::is_trivially_copy_assignable_v   <Result> && std::is_trivially_copy_assignable_v   <Error> &&
+        std::is_trivially_move_assignable_v   <Result> && std::is_trivially_move_assignable_v   <Error> &&
+        std::is_trivially_destructible_v      <Result> && std::is_trivially_destructible_v      <Error>
+    };
+
+    template <class Result>
+    using settled_storage = std::conditional_t<std::is_void_v<Result>, no_err_t, Result>;
+} // namespace detail
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class settled_result
+///
+/// \brief An already inspected, copyable and movable, Result or Error - a
+/// storage type for (bulk) outcomes (vectors, ring buffers, per-task slots).
+///
+/// \detail Constructed from a result_or_error or fallible_result rvalue (which
+/// is thereby inspected - i.e. never throws) by simply moving out the active
+/// member. There are no inspection asserts or flags (the discriminator is
+/// the only state) and for trivially copyable Results and Errors it is itself
+/// trivially copyable (so it is memcpy-ed by standard containers on growth).
+/// Otherwise it is is_trivially_relocatable iff both the Result and the Error
+/// are (see relocate()).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Result, class Error>
+class [[ clang::trivial_abi ]] settled_result
+{
+private:
+    using stored_result = detail::settled_storage<Result>;
+
+public:
+    template <class R, class E> requires std::is_constructible_v<stored_result, detail::settled_storage<R> &&> && std::is_constructible_v<Error, E &&>
+    settled_result( result_or_error<R, E> && source ) noexcept( std::is_nothrow_constructible_v<stored_result, detail::settled_storage<R> &&> && std::is_nothrow_constructible_v<Error, E &&> ) { settle( source ); }
+    template <class R, class E> requires std::is_constructible_v<stored_result, detail::settled_storage<R> &&> && std::is_constructible_v<Error, E &&>
+    settled_result( fallible_result<R, E> && source ) noexcept( std::is_nothrow_constructible_v<stored_result, detail::settled_storage<R> &&> && std::is_nothrow_constructible_v<Error, E &&> ) { settle( detail::result_traits<fallible_result<R, E>>::source( source ) ); }
+
+    template <typename ... Args> requires std::is_constructible_v<stored_result, Args &&...>
+    explicit settled_result( std::in_place_t            , Args && ... args ) noexcept( std::is_nothrow_constructible_v<stored_result, Args &&...> ) : succeeded_( true  ), result_( std::forward<Args>( args )... ) {}
+    template <typename ... Args> requires std::is_constructible_v<Error, Args &&...>
+    explicit settled_result( std::in_place_type_t<Error>, Args && ... args ) noexcept( std::is_nothrow_constructible_v<Error, Args &&...> )         : succeeded_( false ), error_ ( std::forward<Args>( args )... ) {}
+
+    settled_result( settled_result const &  ) requires detail::settled_trivially_copyable<stored_result, Error> = default;
+    settled_result( settled_result       && ) requires detail::settled_trivially_copyable<stored_result, Error> = default;
+    settled_result( settled_result const &  other ) noexcept( std::is_nothrow_copy_constructible_v<stored_result> && std::is_nothrow_copy_constructible_v<Error> ) : succeeded_( other.succeeded_ ) { construct_from(            other   ); }
+    settled_result( settled_result       && other ) noexcept( std::is_nothrow_move_constructible_v<stored_result> && std::is_nothrow_move_constructible_v<Error> ) : succeeded_( other.succeeded_ ) { construct_from( std::move( other ) ); }
+
+    settled_result & operator=( settled_result const &  ) requires detail::settled_trivially_copyable<stored_result, Error> = default;
+    settled_result & operator=( settled_result       && ) requires detail::settled_trivially_copyable<stored_result, Error> = default;
+    /// \note Switching between the Result and the Error states destroys and
+    /// reconstructs: settled_result has no empty state so a throwing (copy)
+    /// construction goes into a temporary first (i.e. the strong guarantee)
+    /// which then requires nothrow move constructible Results and Errors.
+    settled_result & operator=( settled_result const &  other ) noexcept( std::is_nothrow_copy_assignable_v<stored_result> && std::is_nothrow_copy_assignable_v<Error> && std::is_nothrow_copy_constructible_v<stored_result> && std::is_nothrow_copy_constructible_v<Error> ) { return assign(            other   ); }
+    settled_result & operator=( settled_result       && other ) noexcept( std::is_nothrow_move_assignable_v<stored_result> && std::is_nothrow_move_assignable_v<Error> && std::is_nothrow_move_constructible_v<stored_result> && std::is_nothrow_move_constructible_v<Error> ) { return assign( std::move( other ) ); }
+
+    ~settled_result() requires( std::is_trivially_destructible_v<stored_result> && std::is_trivially_destructible_v<Error> ) = default;
+    ~settled_result() noexcept( std::is_nothrow_destructible_v<stored_result> && std::is_nothrow_destructible_v<Error> ) { destroy(); }
+
+    [[ gnu::pure ]]   bool succeeded() const noexcept { return BOOST_LIKELY( succeeded_ ); }
+    explicit operator bool          () const noexcept { return succeeded()               ; }
+
+    Error         const & error () const &  noexcept { BOOST_ASSERT_MSG( !succeeded_, "Querying the error of a succeeded operation." ); return error_; }
+    Error               & error ()       &  noexcept { BOOST_ASSERT_MSG( !succeeded_, "Querying the error of a succeeded operation." ); return error_; }
+    Error              && error ()       && noexcept { return std::move( error() ); }
+    stored_result       & result()       &  noexcept requires( !std::is_void_v<Result> ) { BOOST_ASSERT_MSG( succeeded_, "Querying the result of a failed operation." ); return result_; }
+    stored_result const & result() const &  noexcept requires( !std::is_void_v<Result> ) { return const_cast<settled_result &>( *this ).result(); }
+    stored_result      && result()       && noexcept requires( !std::is_void_v<Result> ) { return std::move( result() ); }
+
+    stored_result       &  operator *  ()       &  noexcept requires( !std::is_void_v<Result> ) { return                 result()  ; }
+    stored_result const &  operator *  () const &  noexcept requires( !std::is_void_v<Result> ) { return                 result()  ; }
+    stored_result       && operator *  ()       && noexcept requires( !std::is_void_v<Result> ) { return std::move     ( result() ); }
+    stored_result       *  operator -> ()          noexcept requires( !std::is_void_v<Result> ) { return std::addressof( result() ); }
+    stored_result const *  operator -> () const    noexcept requires( !std::is_void_v<Result> ) { return std::addressof( result() ); }
+
+    /// Back to the (uninspected) result_or_error (e.g. to throw the Error).
+    result_or_error<Result, Error> as_result_or_error() && noexcept( std::is_nothrow_move_constructible_v<stored_result> && std::is_nothrow_move_constructible_v<Error> )
+    {
+        if ( BOOST_LIKELY( succeeded_ ) )
+        {
+            if constexpr ( std::is_void_v<Result> ) return no_err;
+            else                                    return result_or_error<Result, Error>( std::in_place, std::move( result_ ) );
+        }
+        if constexpr ( compressed_result_error_variant<Result, Error> ) return result_or_error<Result, Error>( std::in_place );
+        else                                                           return result_or_error<Result, Error>( std::in_place_type<Error>, std::move( error_ ) );
+    }
+
+private:
+    template <class Source>
+    void settle( Source & source )
+    {
+        if ( source.succeeded() ) [[ likely ]]
+        {
+            succeeded_ = true;
+            if constexpr ( std::is_void_v<Result> ) { std::move( source ).assume_succeeded(); std::construct_at( &result_ ); }
+            else                                      std::construct_at( &result_, std::move( source ).assume_succeeded() );
+        }
+        else
+        {
+            succeeded_ = false;
+            std::construct_at( &error_, std::move( source ).error() );
+        }
+    }
+
+    template <class Other>
+    void construct_from( Other && other )
+    {
+        if ( BOOST_LIKELY( other.succeeded_ ) ) std::construct_at( &result_, std::forward<Other>( other ).result_ );
+        else                                    std::construct_at( &error_ , std::forward<Other>( other ).error_  );
+    }
+
+    template <class Other>
+    settled_result & assign( Other && other )
+    {
+        if ( this == &other ) [[ unlikely ]]
+            return *this;
+        if ( succeeded_ == other.succeeded_ )
+        {
+            if ( BOOST_LIKELY( succeeded_ ) ) result_ = std::forward<Other>( other ).result_;
+            else                              error_  = std::forward<Other>( other ).error_ ;
+        }
+        else
+        {
+            // (succeeded_ is flipped only after a successful construction)
+            if constexpr ( std::is_nothrow_constructible_v<settled_result, Other &&> )
+            {
+                destroy();
+                construct_from( std::forward<Other>( other ) );
+                succeeded_ = other.succeeded_;
+            }
+            else
+            {
+                static_assert( std::is_nothrow_move_constructible_v<stored_result> && std::is_nothrow_move_constructible_v<Error>, "Switching states requires nothrow move constructible Results and Errors." );
+                settled_result temporary( std::forward<Other>( other ) );
+                destroy();
+                construct_from( std::move( temporary ) );
+                succeeded_ = temporary.succeeded_;
+            }
+        }
+        return *this;
+    }
+
+    void destroy() noexcept( std::is_nothrow_destructible_v<stored_result> && std::is_nothrow_destructible_v<Error> )
+    {
+        if ( BOOST_LIKELY( succeeded_ ) ) std::destroy_at( &result_ );
+        else                              std::destroy_at( &error_  );
+    }
+
+    bool succeeded_;
+    union
+    {
+        stored_result result_;
+        Error         error_ ;
+    };
+}; // class settled_result
+
+template <class Result, class Error>
+struct is_trivially_relocatable<settled_result<Result, Error>>
+    : std::bool_constant<is_trivially_relocatable_v<detail::settled_storage<Result>> && is_trivially_relocatable_v<Error>> {};
+
+
+/// Moves count objects from source to (uninitialised) target storage and ends
+/// the lifetime of the source objects - with a single memcpy for
+/// is_trivially_relocatable types (the growth path of vector-like containers
+/// and ring buffers).
+template <class T>
+void relocate( T * __restrict const source, std::size_t const count, T * __restrict const target ) noexcept
+{
+    if constexpr ( is_trivially_relocatable_v<T> )
+    {
+        if ( count )
+            std::memcpy( static_cast<void *>( target ), static_cast<void const *>( source ), count * sizeof( T ) );
+    }
+    else
+    {
+        static_assert( std::is_nothrow_move_constructible_v<T>, "relocate() requires trivially relocatable or nothrow movable types." );
+        for ( std::size_t i{ 0 }; i < count; ++i )
+        {
+            std::construct_at( &target[ i ], std::move( source[ i ] ) );
+            std::destroy_at  ( &source[ i ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
@@ -0,0 +1,281 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file shared_result.hpp
+/// -----------------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "fallible_result.hpp"
+#include "result_or_error.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+namespace detail
+{
+    // readers only get const access: throw a copy (i.e. leave the published
+    // Error intact for the other readers)
+    template <class Error>
+    [[ noreturn ]] BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+    void BOOST_CC_REG throw_error_copy( Error const & error ) { Error copy( error ); throw_error( copy ); }
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class shared_result
+///
+/// \brief A single-writer/multi-reader slot: the outcome (a Result or an
+/// Error) is published once and then read, in place, by any number of
+/// threads.
+///
+/// \detail The Result or Error is stored inline and publication is a single
+/// release store of a 32 bit state word (with std::atomic::notify_all for the
+/// readers blocked in wait()): after that reading is an acquire load and a
+/// branch - no locking, no reference counting (the slot is neither copyable
+/// nor movable, it has to outlive its readers - its destructor only waits for
+/// the writer to return from notify_all()). Readers get const access to
+/// the Result; a failure is rethrown, fallible_result-style, by get() and
+/// throw_if_error() (a copy of the Error is thrown, the published one stays
+/// intact) or, for readers that want to branch, inspected through
+/// succeeded() and error().
+/// try_claim() elects the writer among competing threads (e.g. the first
+/// cache miss fills the slot while the others wait for it). The claiming
+/// thread has to publish an outcome: if it cannot (e.g. it exits by an
+/// exception) it has to abandon() the slot - the readers then get the
+/// exception (rethrown by get() and throw_if_error()) instead of waiting
+/// forever.
+/// Usage:
+///     if ( slot.try_claim() )
+///     {
+///         try { slot.set( load_from_disk( key ) ); }
+///         catch ( ... ) { slot.abandon(); throw; }
+///     }
+///     auto const & value( slot.get() ); // (waits, throws the Error)
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Result, class Error>
+class alignas( 64 ) shared_result
+{
+public:
+    shared_result() noexcept {}
+    shared_result( shared_result const & ) = delete;
+   ~shared_result() noexcept( ( std::is_void_v<Result> || std::is_nothrow_destructible_v<Result> ) && std::is_nothrow_destructible_v<Error> )
+    {
+        while ( BOOST_UNLIKELY( notifying_.load( std::memory_order_acquire ) ) )
+            std::this_thread::yield();
+        destroy( state_.load( std::memory_order_acquire ) );
+    }
+
+    // Writer
+    /// Whether the caller became the (only) writer of the slot.
+    bool try_claim() noexcept
+    {
+        auto expected( empty );
+        return state_.compare_exchange_strong( expected, claimed, std::memory_order_relaxed, std::memory_order_relaxed );
+    }
+
+    template <typename ... Args>
+    void set_result( Args && ... args ) noexcept( std::is_void_v<Result> || std::is_nothrow_constructible_v<Result, Args &&...> )
+    {
+        BOOST_ASSERT_MSG( !ready(), "The outcome has already been published." );
+        if constexpr ( !std::is_void_v<Result> )
+            std::construct_at( &result_, std::forward<Args>( args )... );
+        publish( succeeded_state );
+    }
+
+    template <typename ... Args>
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    void set_error( Args && ... args ) noexcept( std::is_nothrow_constructible_v<Error, Args &&...> )
+    {
+        BOOST_ASSERT_MSG( !ready(), "The outcome has already been published." );
+        std::construct_at( &error_, std::forward<Args>( args )... );
+        publish( failed_state );
+    }
+
+    template <class R, class E> void set( result_or_error<R, E> && source ) { settle( source ); }
+    template <class R, class E> void set( fallible_result<R, E> && source ) { settle( detail::result_traits<fallible_result<R, E>>::source( source ) ); }
+
+#ifndef BOOST_NO_EXCEPTIONS
+    /// Publishes an exception instead of an outcome (by default the one being
+    /// handled or, outside of a handler, a std::future_error w/
+    /// broken_promise).
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    void abandon( std::exception_ptr exception = std::current_exception() ) noexcept
+    {
+        BOOST_ASSERT_MSG( !ready(), "The outcome has already been published." );
+        exception_ = exception ? std::move( exception ) : std::make_exception_ptr( std::future_error( std::future_errc::broken_promise ) );
+        publish( abandoned_state );
+    }
+#endif // BOOST_NO_EXCEPTIONS
+
+    // Readers
+    bool ready() const noexcept { return state_.load( std::memory_order_acquire ) >= succeeded_state; }
+
+    void wait() const noexcept
+    {
+        if ( !ready() ) [[ unlikely ]]
+            wait_published();
+    }
+
+    /// Blocks until the outcome is published.
+    bool succeeded() const noexcept { return published() == succeeded_state; }
+    /// Blocks until the outcome is published (i.e. whether there is no Result
+    /// nor an Error but an exception - see abandon()).
+    bool abandoned() const noexcept { return published() == abandoned_state; }
+
+    /// \note The outcome has to be published (and inspected).
+    decltype( auto ) result() const noexcept
+    {
+        BOOST_ASSERT_MSG( state_.load( std::memory_order_relaxed ) == succeeded_state, "Querying the result of a failed (or unpublished) outcome." );
+        if constexpr ( !std::is_void_v<Result> ) return static_cast<Result const &>( result_ );
+    }
+    Error const & error() const noexcept
+    {
+        BOOST_ASSERT_MSG( state_.load( std::memory_order_relaxed ) == failed_state, "Querying the error of a succeeded (or unpublished) outcome." );
+        return error_;
+    }
+
+    /// Blocks until the outcome is published and returns the Result or throws
+    /// the Error.
+    decltype( auto ) get() const
+    {
+        throw_if_error();
+        return result();
+    }
+
+    void throw_if_error() const
+    {
+        // (a single test on the hot path: waiting and failing both go out of line)
+        if ( BOOST_UNLIKELY( state_.load( std::memory_order_acquire ) != succeeded_state ) )
+            wait_and_throw_if_error();
+    }
+
+    /// A copy of the outcome (as a fallible_result, i.e. the Error is thrown
+    /// if the copy is left uninspected - the exception of an abandoned slot is
+    /// rethrown immediately).
+    fallible_result<Result, Error> get_fallible() const
+    {
+        using target = fallible_result<Result, Error>;
+        auto const state( published() );
+        if ( BOOST_LIKELY( state == succeeded_state ) )
+        {
+            if constexpr ( std::is_void_v<Result> ) return detail::make_succeeded<target>();
+            else                                    return detail::make_succeeded<target>( result_ );
+        }
+    #ifndef BOOST_NO_EXCEPTIONS
+        if ( state == abandoned_state )
+            std::rethrow_exception( exception_ );
+    #endif // BOOST_NO_EXCEPTIONS
+        return detail::make_failed<target>( Error( error_ ) );
+    }
+
+private:
+    using state_t = std::uint32_t;
+
+    static state_t constexpr empty           = 0;
+    static state_t constexpr claimed         = 1;
+    static state_t constexpr succeeded_state = 2;
+    static state_t constexpr failed_state    = 3;
+    static state_t constexpr abandoned_state = 4;
+
+    template <class Source>
+    void settle( Source & source )
+    {
+        if ( source.succeeded() ) [[ likely ]]
+        {
+            if constexpr ( std::is_void_v<Result> ) { std::move( source ).assume_succeeded(); set_result(); }
+            else                                      set_result( std::move( source ).assume_succeeded() );
+        }
+        else
+            set_error( std::move( source ).error() );
+    }
+
+    // A reader that observes the store may go on to destroy the slot while the
+    // writer is still inside notify_all(): notifying_ keeps the destructor
+    // waiting until it returns.
+    void publish( state_t const state ) noexcept
+    {
+        notifying_.fetch_add( 1, std::memory_order_relaxed );
+        state_.store( state, std::memory_order_release );
+        state_.notify_all();
+        notifying_.fetch_sub( 1, std::memory_order_release );
+    }
+
+    state_t published() const noexcept
+    {
+        auto const state( state_.load( std::memory_order_acquire ) );
+        if ( state >= succeeded_state ) [[ likely ]]
+            return state;
+        return wait_published();
+    }
+
+    BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+    state_t wait_published() const noexcept
+    {
+        for ( auto state{ state_.load( std::memory_order_acquire ) }; ; state = state_.load( std::memory_order_acquire ) )
+        {
+            if ( state >= succeeded_state )
+                return state;
+            state_.wait( state, std::memory_order_acquire );
+        }
+    }
+
+    BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+    void wait_and_throw_if_error() const
+    {
+        auto const state( wait_published() );
+        if ( state == failed_state )
+            detail::throw_error_copy( error_ );
+    #ifndef BOOST_NO_EXCEPTIONS
+        if ( state == abandoned_state )
+            std::rethrow_exception( exception_ );
+    #endif // BOOST_NO_EXCEPTIONS
+    }
+
+    void destroy( state_t const state ) noexcept
+    {
+        if constexpr ( !std::is_void_v<Result> )
+            if ( state == succeeded_state ) { std::destroy_at( &result_ ); return; }
+        if ( state == failed_state ) std::destroy_at( &error_ );
+    }
+
+    std::atomic<state_t> mutable state_    { empty };
+    std::atomic<state_t>         notifying_{ 0     };
+    union
+    {
+        std::conditional_t<std::is_void_v<Result>, no_err_t, Result> result_;
+        Error                                                        error_ ;
+    };
+#ifndef BOOST_NO_EXCEPTIONS
+    std::exception_ptr exception_;
+#endif // BOOST_NO_EXCEPTIONS
+}; // class shared_result
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
@@ -0,0 +1,218 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \file traced.hpp
+/// ----------------
+///
+/// Copyright (c) Domagoj Saric 2026.
+///
+/// Use, modification and distribution is subject to the
+/// Boost Software License, Version 1.0.
+/// (See accompanying file LICENSE_1_0.txt or copy at
+/// http://www.boost.org/LICENSE_1_0.txt)
+///
+/// For more information, see http://www.boost.org
+///
+////////////////////////////////////////////////////////////////////////////////
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "exceptions.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/config_ex.hpp>
+#include <boost/stacktrace/safe_dump_to.hpp>
+#include <boost/stacktrace/stacktrace.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+//------------------------------------------------------------------------------
+namespace psi::err
+{
+//------------------------------------------------------------------------------
+
+namespace detail
+{
+    using native_frame = boost::stacktrace::frame::native_frame_ptr_t;
+
+    // Raw return addresses (as captured by Boost.Stacktrace's async-signal-safe
+    // safe_dump_to(): no allocation, no symbol lookup)
+    template <std::uint8_t Depth>
+    class frame_dump
+    {
+    public:
+        BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+        void capture( std::size_t const skip ) noexcept
+        {
+            // +1: this function, (the +1 slot is safe_dump_to's null terminator)
+            auto const dumped( boost::stacktrace::safe_dump_to( skip + 1, frames_, sizeof( frames_ ) ) );
+            size_ = static_cast<std::uint8_t>( dumped ? dumped - 1 : 0 );
+        }
+
+        std::span<native_frame const> frames() const noexcept { return { frames_, size_ }; }
+
+        // (symbol lookup happens only when the returned object is printed)
+        boost::stacktrace::stacktrace stacktrace() const { return boost::stacktrace::stacktrace::from_dump( frames_, size_ * sizeof( native_frame ) ); }
+
+    private:
+        native_frame frames_[ Depth + 1 ];
+        std::uint8_t size_{ 0 };
+    }; // class frame_dump
+
+    // what() text composed on first use (a copy, e.g. boost::wrapexcept's
+    // clone, starts out empty)
+    struct lazy_description
+    {
+        lazy_description() noexcept = default;
+        lazy_description( lazy_description const & ) noexcept {}
+        lazy_description & operator=( lazy_description const & ) noexcept { return *this; }
+
+        std::once_flag mutable once;
+        std::string    mutable text;
+    }; // struct lazy_description
+} // namespace detail
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class traced
+///
+/// \brief An Error decorator that records where the Error was created: the
+/// raw return addresses of the call stack are captured (into an inline,
+/// fixed size array) by the (cold, out-of-line) constructor.
+///
+/// \detail Symbolisation is deferred: it happens only if stacktrace() is
+/// printed (e.g. logged) or when the what() of the exception made from the
+/// traced Error is called - a transient failure that gets handled costs only
+/// the stack walk. The exception (made with make_exception() from the
+/// decorated Error's own make_exception()) derives from the original exception
+/// type (so existing catch clauses still work) - unless that one is not
+/// derived from std::exception or is final in which case the trace is lost in
+/// the conversion.
+/// Copies retain the original trace.
+/// Usage:
+///     fallible_result<std::size_t, traced<last_errno>> read( ... ) { ... if ( result < 0 ) return last_errno{}; ... }
+/// Symbolisation requires the Boost.Stacktrace backend to be linked in as per
+/// its configuration (e.g. -ldl or -lboost_stacktrace_backtrace).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Error, std::uint8_t Depth = 16>
+class traced
+{
+public:
+    using error_type = Error;
+
+    static std::uint8_t constexpr depth = Depth;
+
+    // (the trace is captured by the constructors - skipping their own frame)
+    BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD ) traced(                      ) noexcept( std::is_nothrow_default_constructible_v<Error> ) requires std::is_default_constructible_v<Error> : error_{}                   { trace_.capture( 1 ); }
+    BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD ) traced( Error const  & error ) noexcept( std::is_nothrow_copy_constructible_v   <Error> )                                             : error_( error            ) { trace_.capture( 1 ); }
+    BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD ) traced( Error       && error ) noexcept( std::is_nothrow_move_constructible_v   <Error> )                                             : error_( std::move( error ) ) { trace_.capture( 1 ); }
+
+    template <typename ... Args> requires std::is_constructible_v<Error, Args &&...>
+    BOOST_NOINLINE BOOST_ATTRIBUTES( BOOST_COLD )
+    explicit traced( std::in_place_t, Args && ... args ) noexcept( std::is_nothrow_constructible_v<Error, Args &&...> )
+        : error_( std::forward<Args>( args )... ) { trace_.capture( 1 ); }
+
+    Error       &  error()       &  noexcept { return error_; }
+    Error const &  error() const &  noexcept { return error_; }
+    Error       && error()       && noexcept { return std::move( error_ ); }
+
+    operator Error const & () const noexcept { return error_; }
+
+    /// The captured return addresses (innermost first).
+    std::span<detail::native_frame const> frames() const noexcept { return trace_.frames(); }
+
+    /// \note Performs no symbol lookup itself - that happens when the returned
+    /// stacktrace (or its frames) get printed.
+    boost::stacktrace::stacktrace stacktrace() const { return trace_.stacktrace(); }
+
+    detail::frame_dump<Depth> const & dump() const noexcept { return trace_; }
+
+private:
+    Error                     error_;
+    detail::frame_dump<Depth> trace_;
+}; // class traced
+
+namespace detail
+{
+    template <class T>
+    bool constexpr is_traced{ false };
+    template <class Error, std::uint8_t Depth>
+    bool constexpr is_traced<traced<Error, Depth>>{ true };
+} // namespace detail
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class traced_exception
+///
+/// \brief The exception made from a traced<Error>: Exception (the one made
+/// from the Error) plus the trace captured when the Error was created.
+///
+/// \detail what() returns Exception::what() followed by the symbolised trace
+/// (composed once, on the first call - falls back to the plain
+/// Exception::what() if that fails).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+template <class Exception, std::uint8_t Depth>
+class traced_exception : public Exception
+{
+public:
+    traced_exception( Exception && exception, detail::frame_dump<Depth> const & trace ) noexcept( std::is_nothrow_move_constructible_v<Exception> )
+        : Exception( std::move( exception ) ), trace_( trace ) {}
+
+    char const * what() const noexcept override
+    {
+        std::call_once
+        (
+            description_.once,
+            [ this ]() noexcept
+            {
+            #ifndef BOOST_NO_EXCEPTIONS
+                try {
+            #endif // BOOST_NO_EXCEPTIONS
+                description_.text  = Exception::what();
+                description_.text += '\n';
+                description_.text += boost::stacktrace::to_string( trace_.stacktrace() );
+            #ifndef BOOST_NO_EXCEPTIONS
+                } catch ( ... ) { description_.text.clear(); }
+            #endif // BOOST_NO_EXCEPTIONS
+            }
+        );
+        return description_.text.empty() ? Exception::what() : description_.text.c_str();
+    }
+
+    std::span<detail::native_frame const> frames() const noexcept { return trace_.frames(); }
+
+    boost::stacktrace::stacktrace stacktrace() const { return trace_.stacktrace(); }
+
+private:
+    detail::frame_dump<Depth> trace_;
+    detail::lazy_description  description_;
+}; // class traced_exception
+
+
+template <class Traced>
+requires detail::is_traced<std::remove_cvref_t<Traced>>
+BOOST_ATTRIBUTES( BOOST_COLD )
+auto BOOST_CC_REG make_exception( Traced && error )
+{
+    auto && exception{ make_exception( std::forward<Traced>( error ).error() ) }; // (ADL)
+    using exception_t = std::remove_cvref_t<decltype( exception )>;
+    if constexpr ( std::is_base_of_v<std::exception, exception_t> && !std::is_final_v<exception_t> )
+        return traced_exception<exception_t, std::remove_cvref_t<Traced>::depth>( exception_t( std::forward<decltype( exception )>( exception ) ), error.dump() );
+    else
+        return exception_t( std::forward<decltype( exception )>( exception ) );
+}
+
+//------------------------------------------------------------------------------
+} // namespace psi::err
+//------------------------------------------------------------------------------
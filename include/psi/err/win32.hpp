@@ -16,6 +16,8 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include "result_or_error.hpp"
+
 #include <boost/assert.hpp>
 #include <boost/config_ex.hpp>
 #include <boost/winapi/error_handling.hpp>
@@ -31,9 +33,11 @@
 #include <windows.h>
 #undef __bound
 
+#include <atomic>
 #include <cstdint>
-#include <cstring>  // needed for std::strlen
-#include <stdexcept>
+#include <exception>
+#include <new>
+#include <utility>
 //------------------------------------------------------------------------------
 namespace psi::err
 {
@@ -67,9 +71,11 @@ struct last_win32_error
     BOOST_ATTRIBUTES( BOOST_MINSIZE, BOOST_RESTRICTED_FUNCTION_L2, BOOST_EXCEPTIONLESS, BOOST_WARN_UNUSED_RESULT )
     static bool       is() noexcept { return is( value ); }
 
-    /// \todo Interferes with result_or_error constructor SFINAE selection
-    /// for Result types constructible from value_type if implicit. Cleanup...
-    ///                                       (08.10.2015.) (Domagoj Saric)
+    /// \note Deliberately explicit: if implicit, an Error source would also
+    /// be a (preferred) Result source for Result types constructible from
+    /// value_type, i.e. the result_or_error constructor selection would be
+    /// ambiguous (e.g. for int Results with traced<> Errors - see
+    /// detail::preferred_source).
     explicit
     operator value_type() const noexcept { return value/*get()*/; }
 
@@ -92,36 +98,199 @@ struct last_win32_error
 inline thread_local std::uint8_t last_win32_error::instance_counter( 0 );
 #endif // NDEBUG
 
+template <> struct sentinel_traits<last_win32_error> { static last_win32_error::value_type constexpr unknown_error = ERROR_UNIDENTIFIED_ERROR; };
 
-inline BOOST_ATTRIBUTES( BOOST_COLD )
-std::runtime_error make_exception( last_win32_error const error )
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class current_win32_error
+///
+/// \brief A stateless view of the calling thread's last (GetLastError())
+/// error - see current_errno.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+struct current_win32_error
 {
-    using namespace boost::winapi;
+    using value_type = last_win32_error::value_type;
 
-    BOOST_ASSERT_MSG( error.value != last_win32_error::no_error, "Throwing on no error?" );
+    static value_type const no_error = 0;
+
+    /// \note See last_win32_error::operator value_type.
+    explicit
+    operator value_type() const noexcept { return last_win32_error::get(); }
 
-    char message[ 128 ];
-    auto const message_length
-    (
-        ::FormatMessageA
+    /// Captures the current value.
+    operator last_win32_error() const noexcept { return {}; }
+}; // struct current_win32_error
+
+static_assert( is_stateless_error<current_win32_error> );
+static_assert( sizeof( result_or_error<void * /*HANDLE*/, current_win32_error> ) == sizeof( std::pair<void *, bool> ), "current_win32_error has to take no space." );
+
+
+namespace detail
+{
+    /// FormatMessage()s a system message into a LocalAlloc()ated buffer
+    /// (stripped of the trailing line break) - nullptr on failure.
+    inline BOOST_ATTRIBUTES( BOOST_COLD )
+    char * format_system_message( std::uint32_t const code, void const * const module = nullptr ) noexcept
+    {
+        using namespace boost::winapi;
+
+        char * message{ nullptr };
+        auto length
         (
-            FORMAT_MESSAGE_FROM_SYSTEM_ | FORMAT_MESSAGE_IGNORE_INSERTS_,
-            nullptr, error.value, 0, message, _countof( message ), 0
-        )
-    );
-#ifdef __clang__
-#   pragma clang diagnostic push
-#   pragma clang diagnostic ignored "-Wassume"
-#endif
-    BOOST_ASSUME( message_length                           );
-#ifndef _MSC_VER // VS 17.10.0 MSVC ICE
-    BOOST_ASSUME( std::strlen( message ) == message_length );
-#endif
-#ifdef __clang__
-#   pragma clang diagnostic pop
-#endif
-
-    return std::runtime_error( message );
+            ::FormatMessageA
+            (
+                FORMAT_MESSAGE_ALLOCATE_BUFFER_ | FORMAT_MESSAGE_IGNORE_INSERTS_ | ( module ? FORMAT_MESSAGE_FROM_HMODULE_ : FORMAT_MESSAGE_FROM_SYSTEM_ ),
+                module, code, 0, reinterpret_cast<char *>( &message ), 0, nullptr
+            )
+        );
+        if ( !length )
+            return nullptr;
+        while ( length && ( message[ length - 1 ] == '\n' || message[ length - 1 ] == '\r' || message[ length - 1 ] == ' ' ) )
+            message[ --length ] = '\0';
+        return message;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    ///
+    /// \class message_cache
+    ///
+    /// \brief Process-wide cache of formatted (error code) messages.
+    ///
+    /// \detail A fixed size, insert-only, open addressing table of atomic
+    /// pointers to immortal (never freed) entries: once an entry is filled
+    /// lookups are lock-free (an acquire load per probe). FormatMessage is
+    /// called only the first time a particular code is seen (threads racing on
+    /// the first fill may format the same message concurrently, the losers
+    /// discard their copy). Once the table is full the messages of further
+    /// codes are formatted on every call (and leaked).
+    ///
+    ////////////////////////////////////////////////////////////////////////////
+
+    template <char * ( * format )( std::uint32_t code ) noexcept>
+    class message_cache
+    {
+    public:
+        BOOST_ATTRIBUTES( BOOST_COLD )
+        char const * get( std::uint32_t const code ) noexcept
+        {
+            entry * new_entry{ nullptr };
+            auto hash( code * 2654435761U );
+            for ( std::uint16_t probe{ 0 }; probe < capacity; ++probe, ++hash )
+            {
+                auto & slot( slots_[ hash % capacity ] );
+                auto   existing( slot.load( std::memory_order_acquire ) );
+                if ( !existing )
+                {
+                    if ( !new_entry )
+                    {
+                        new_entry = make_entry( code );
+                        if ( !new_entry )
+                            return unknown;
+                    }
+                    if ( slot.compare_exchange_strong( existing, new_entry, std::memory_order_acq_rel, std::memory_order_acquire ) )
+                        return new_entry->message;
+                }
+                BOOST_ASSUME( existing );
+                if ( existing->code == code )
+                {
+                    if ( new_entry )
+                        free_entry( new_entry );
+                    return existing->message;
+                }
+            }
+            // table full: no caching - the message is deliberately leaked
+            // (what() has to stay valid for the lifetime of the exception)
+            if ( new_entry )
+            {
+                auto const message( new_entry->message );
+                delete new_entry;
+                return message;
+            }
+            auto const message( format( code ) );
+            return message ? message : unknown;
+        }
+
+    private:
+        struct entry
+        {
+            std::uint32_t code;
+            char *        message;
+        };
+
+        static entry * make_entry( std::uint32_t const code ) noexcept
+        {
+            auto const message( format( code ) );
+            if ( !message )
+                return nullptr;
+            auto const new_entry( new ( std::nothrow ) entry{ code, message } );
+            if ( !new_entry )
+                ::LocalFree( message );
+            return new_entry;
+        }
+
+        static void free_entry( entry * const discarded ) noexcept
+        {
+            ::LocalFree( discarded->message );
+            delete discarded;
+        }
+
+        static std::uint16_t constexpr capacity = 256;
+        static char          constexpr unknown[] = "Unknown error";
+
+        std::atomic<entry *> slots_[ capacity ] = {};
+    }; // class message_cache
+
+    inline BOOST_ATTRIBUTES( BOOST_COLD ) char * format_win32_message( std::uint32_t const code ) noexcept { return format_system_message( code ); }
+
+    inline constinit message_cache<&format_win32_message> system_messages;
+} // namespace detail
+
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// \class win32_error
+///
+/// \brief The exception thrown for last_win32_error errors.
+///
+/// \detail what() points into the process-wide message cache (i.e. the
+/// exception object stores only the code and a pointer - it never allocates).
+///
+////////////////////////////////////////////////////////////////////////////////
+
+class win32_error : public std::exception
+{
+public:
+    using value_type = last_win32_error::value_type;
+
+    BOOST_ATTRIBUTES( BOOST_COLD )
+    explicit win32_error( value_type const code ) noexcept : code_( code ), message_( detail::system_messages.get( code ) ) {}
+
+    value_type code() const noexcept { return code_; }
+
+    char const * what() const noexcept override { return message_; }
+
+private:
+    value_type   code_   ;
+    char const * message_;
+}; // class win32_error
+
+
+inline BOOST_ATTRIBUTES( BOOST_COLD )
+win32_error make_exception( last_win32_error const error ) noexcept
+{
+    BOOST_ASSERT_MSG( error.value != last_win32_error::no_error, "Throwing on no error?" );
+    return win32_error( error.value );
+}
+
+inline BOOST_ATTRIBUTES( BOOST_COLD )
+win32_error make_exception( current_win32_error const error ) noexcept
+{
+    // (see make_exception( current_errno ))
+    auto const value( static_cast<current_win32_error::value_type>( error ) );
+    return win32_error( ( value != current_win32_error::no_error ) ? value : sentinel_traits<last_win32_error>::unknown_error );
 }
 
 BOOST_OPTIMIZE_FOR_SIZE_END()